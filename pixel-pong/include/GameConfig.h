@@ -0,0 +1,28 @@
+#ifndef GAMECONFIG_H
+#define GAMECONFIG_H
+
+// Game logic configuration, shared by the firmware (src/main.cpp) and the native simulator (src/sim).
+//_______ Game Variables
+// The board can be made up of several LED panels, see LED_TILES_X & LED_TILES_Y in src/main.cpp
+#define GAME_BOARD_X 8                  // Size of the game board x dimension in pixels
+#define GAME_BOARD_Y 8                  // Size of the game board y dimension in pixels
+#define GAME_PADDLE_SIZE 3              // Size of the paddles in pixels
+#define GAME_PADDLE_ANCHOR 1            // The pixel that is used to specify anchor positon @see Paddle::Paddle
+#define GAME_PADDLE_HIT_REGIONS 1, 1, 1 // The HitRegions for the paddles @see Paddle::HitRegions
+//_______ Game Starting States
+// Placed relative to the board size, so they hold for any board
+#define INITIAL_BALL_POSITION_ON(boardX, boardY) (boardX) / 2, (boardY) / 4
+#define INITIAL_PADDLE_POSITION1_ON(boardX, boardY) 0, ((boardY) - 1) / 2
+#define INITIAL_PADDLE_POSITION2_ON(boardX, boardY) (boardX) - 1, ((boardY) - 1) / 2
+#define INITIAL_BALL_POSITION INITIAL_BALL_POSITION_ON(GAME_BOARD_X, GAME_BOARD_Y)
+#define INITIAL_BALL_VELOCITY -1, 0
+#define INITIAL_PADDLE_POSITION1 INITIAL_PADDLE_POSITION1_ON(GAME_BOARD_X, GAME_BOARD_Y)
+#define INITIAL_PADDLE_POSITION2 INITIAL_PADDLE_POSITION2_ON(GAME_BOARD_X, GAME_BOARD_Y)
+//_______ Game Controls
+#define CONTROL_HEIGHT_LOWER 5     // cm for which any lower value will be classed as the lower state.
+#define CONTROL_HEIGHT_INCREMENT 5 // cm value indicated the size of the region corresponding to each paddle position.
+                                   // i.e if Ultrasonic sensor height < CONTROL_HEIGHT_LOWER paddle will be in the first state
+                                   //     if CONTROL_HEIGHT_LOWER <= Ultrasonic sensor height < CONTROL_HEIGHT_LOWER + n*CONTROL_HEIGHT_INCREMENT
+                                   //     paddle will be in state n.
+
+#endif // GAMECONFIG_H
@@ -0,0 +1,124 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                          ALLOCATION COUNTER                                                
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Running totals, atomic as any task (or thread) may allocate.
+ */
+static std::atomic<unsigned long> allocationCount(0);
+static std::atomic<unsigned long> deallocationCount(0);
+static std::atomic<unsigned long> allocatedBytes(0);
+
+unsigned long getAllocationCount()
+{
+  return allocationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long getDeallocationCount()
+{
+  return deallocationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long getAllocatedBytes()
+{
+  return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+#ifdef PONG_COUNT_ALLOCATIONS
+
+/**
+ * >                     COUNTING OPERATORS
+ * ---------------------------------------
+*/
+/**
+ * @brief Allocate and record a block, returning NULL on failure.
+ */
+static void *countedAllocate(size_t size)
+{
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  return malloc(size == 0 ? 1 : size);
+}
+
+/**
+ * @brief Allocate and record a block, failing the same way the standard operator new would.
+ */
+static void *countedAllocateOrFail(size_t size)
+{
+  void *block = countedAllocate(size);
+  if (block == NULL)
+  {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+    throw std::bad_alloc();
+#else
+    abort();
+#endif
+  }
+  return block;
+}
+
+/**
+ * @brief Record and free a block.
+ */
+static void countedFree(void *block)
+{
+  if (block != NULL)
+  {
+    deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    free(block);
+  }
+}
+
+void *operator new(size_t size)
+{
+  return countedAllocateOrFail(size);
+}
+
+void *operator new[](size_t size)
+{
+  return countedAllocateOrFail(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  return countedAllocate(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  return countedAllocate(size);
+}
+
+void operator delete(void *block) noexcept
+{
+  countedFree(block);
+}
+
+void operator delete[](void *block) noexcept
+{
+  countedFree(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+  countedFree(block);
+}
+
+void operator delete[](void *block, size_t) noexcept
+{
+  countedFree(block);
+}
+
+#endif // PONG_COUNT_ALLOCATIONS
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,49 @@
+#ifndef PONGALLOCATIONCOUNTER_H
+#define PONGALLOCATIONCOUNTER_H
+
+/**
+ * ==================================================================================================================
+ * ~                                          ALLOCATION COUNTER                                                
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Hook for counting heap allocations made through operator new.
+ *    Only active when built with PONG_COUNT_ALLOCATIONS defined, in which
+ *    case the global operator new/delete are replaced with counting versions.
+ *    Used to check that the game tick never allocates.
+ */
+
+/**
+ * @brief Whether or not allocations are being counted in this build.
+ */
+#ifdef PONG_COUNT_ALLOCATIONS
+#define ALLOCATION_COUNTING_ENABLED true
+#else
+#define ALLOCATION_COUNTING_ENABLED false
+#endif
+
+/**
+ * @brief Get the number of allocations made through operator new since
+ *    start up. Always 0 when counting is disabled.
+ */
+unsigned long getAllocationCount();
+
+/**
+ * @brief Get the number of deallocations made through operator delete
+ *    since start up. Always 0 when counting is disabled.
+ */
+unsigned long getDeallocationCount();
+
+/**
+ * @brief Get the total number of bytes requested through operator new
+ *    since start up. Always 0 when counting is disabled.
+ */
+unsigned long getAllocatedBytes();
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGALLOCATIONCOUNTER_H
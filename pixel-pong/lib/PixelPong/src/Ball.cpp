@@ -17,7 +17,7 @@
  * @param initalVelocity The starting velocity of the Ball.
  */
 Ball::Ball(Position initialPosition, Velocity initialVelocity)
-    : position(initialPosition),
+    : position(PrecisePosition::fromPosition(initialPosition)),
       velocity(initialVelocity) {}
 
 /**
@@ -25,7 +25,7 @@ Ball::Ball(Position initialPosition, Velocity initialVelocity)
  */
 void Ball::updatePosition()
 {
-  Position newPosition = {
+  PrecisePosition newPosition = {
       position.x + velocity.x,
       position.y + velocity.y};
 
@@ -39,9 +39,19 @@ void Ball::updatePosition()
 /**
  * @brief Get the current position of the ball.
  * 
- * @return The current position of the ball.
+ * @return The pixel the ball is on.
  */
 Position Ball::getPosition()
+{
+  return position.toPosition();
+}
+
+/**
+ * @brief Get the current sub-pixel position of the ball.
+ * 
+ * @return The current sub-pixel position of the ball.
+ */
+PrecisePosition Ball::getPrecisePosition()
 {
   return position;
 }
@@ -56,6 +66,16 @@ Velocity Ball::getVelocity()
   return velocity;
 }
 
+/**
+ * @brief Get the current speed of the ball.
+ * 
+ * @return The current speed in pixels per timestep.
+ */
+fixed_t Ball::getSpeed()
+{
+  return velocity.getSpeed();
+}
+
 /**
  * _____________ SETTERS
  */
@@ -66,6 +86,16 @@ Velocity Ball::getVelocity()
  * @param newPosition The new Position of the Ball.
  */
 void Ball::setPosition(Position newPosition)
+{
+  this->position = PrecisePosition::fromPosition(newPosition);
+}
+
+/**
+ * @brief Set the Ball's sub-pixel Position.
+ * 
+ * @param newPosition The new sub-pixel Position of the Ball.
+ */
+void Ball::setPrecisePosition(PrecisePosition newPosition)
 {
   this->position = newPosition;
 }
@@ -80,6 +110,16 @@ void Ball::setVelocity(Velocity newVelocity)
   this->velocity = newVelocity;
 }
 
+/**
+ * @brief Set the Ball's speed, keeping its direction.
+ * 
+ * @param newSpeed The new speed in pixels per timestep.
+ */
+void Ball::setSpeed(fixed_t newSpeed)
+{
+  this->velocity = velocity.withSpeed(newSpeed);
+}
+
 /**
  * ----------------------------------------------------------------------------------------------------------------- 
  * =================================================================================================================
@@ -11,6 +11,8 @@
 
 /**
  * @brief Class representing the ball entity in the game of Pong.
+ *    The ball moves with sub-pixel precision, its Position is the
+ *    pixel it is drawn on.
  */
 class Ball
 {
@@ -27,6 +29,7 @@ public:
 
   /**
    * @brief Update the Ball's Position based on its Velocity.
+   *    Moves the ball by one timestep worth of its Velocity.
    */
   void updatePosition();
 
@@ -35,26 +38,44 @@ public:
    */
 
   /**
-   * @brief Get the Ball's current Position.
+   * @brief Get the Ball's current Position (the pixel it is on).
    */
   Position getPosition();
 
+  /**
+   * @brief Get the Ball's current sub-pixel Position.
+   */
+  PrecisePosition getPrecisePosition();
+
   /**
    * @brief Get the Ball's current Velocity.
    */
   Velocity getVelocity();
 
+  /**
+   * @brief Get the Ball's current speed in pixels per timestep.
+   *    @see Velocity::getSpeed
+   */
+  fixed_t getSpeed();
+
   /**
    * _____________ SETTERS
    */
 
   /**
-   * @brief Set the Ball's Position.
+   * @brief Set the Ball's Position, placing it in the centre of the pixel.
    * 
    * @param newPosition The new Position of the Ball.
    */
   void setPosition(Position newPosition);
 
+  /**
+   * @brief Set the Ball's sub-pixel Position.
+   * 
+   * @param newPosition The new sub-pixel Position of the Ball.
+   */
+  void setPrecisePosition(PrecisePosition newPosition);
+
   /**
    * @brief Set the Ball's Velocity.
    * 
@@ -62,14 +83,22 @@ public:
    */
   void setVelocity(Velocity newVelocity);
 
+  /**
+   * @brief Set the Ball's speed, keeping its direction.
+   * 
+   * @param newSpeed The new speed in pixels per timestep.
+   *    @see Velocity::getSpeed
+   */
+  void setSpeed(fixed_t newSpeed);
+
 private:
   /**
    * _____________ MEMEBER VARIABLES
    */
   /**
-   * @brief The current Position of the Ball.
+   * @brief The current sub-pixel Position of the Ball.
    */
-  Position position;
+  PrecisePosition position;
 
   /**
    * @brief The current Velocity of the Ball.
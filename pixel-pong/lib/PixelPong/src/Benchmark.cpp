@@ -0,0 +1,30 @@
+#include "Benchmark.h"
+#include <stdio.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+volatile int benchmarkSink = 0;
+
+const char *BENCHMARK_CSV_HEADER = "name,iterations,ns_per_op,cycles_per_op";
+
+/**
+ * @brief Format a benchmark result as a CSV row
+ *    (name,iterations,ns_per_op,cycles_per_op).
+ * 
+ * @param result The result to format.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatBenchmarkResult(BenchmarkResult result, char *buffer, int size)
+{
+  snprintf(buffer, size, "%s,%lu,%.2f,%.2f", result.name, result.iterations, result.nsPerOp, result.cyclesPerOp);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
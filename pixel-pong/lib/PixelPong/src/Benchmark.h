@@ -0,0 +1,113 @@
+#ifndef PONGBENCHMARK_H
+#define PONGBENCHMARK_H
+
+#include "Platform.h"
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The measurements taken for a single benchmark.
+ */
+struct BenchmarkResult
+{
+  const char *name;         /// Name of the benchmark.
+  unsigned long iterations; /// Number of times the operation was run.
+  double nsPerOp;           /// Average wall clock nanoseconds per operation.
+  double cyclesPerOp;       /// Average cycle counter ticks per operation @see platformCycleCount
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Sink for benchmark results so the compiler cannot optimise
+ *    away the operations being measured.
+ */
+extern volatile int benchmarkSink;
+
+/**
+ * @brief Number of operations timed between reads of the cycle counter.
+ *    Keeps every interval well under the counter's wrap period.
+ */
+#define BENCHMARK_BATCH_SIZE 1000
+
+/**
+ * @brief Measure the cost of an operation by running it in batches
+ *    until at least minDurationMicros has elapsed.
+ * 
+ * @param name Name of the benchmark.
+ * @param minDurationMicros Minimum time to spend measuring.
+ * @param operation Callable run once per iteration, returning an int
+ *    that is folded into benchmarkSink.
+ * 
+ * @return The measurements taken.
+ */
+template <typename Operation>
+BenchmarkResult runBenchmark(const char *name, unsigned long minDurationMicros, Operation operation)
+{
+  // Warm up caches & branch predictors
+  for (int i = 0; i < BENCHMARK_BATCH_SIZE; i++)
+  {
+    benchmarkSink += operation();
+  }
+
+  unsigned long iterations = 0;
+  uint64_t cycles = 0;
+  unsigned long startMicros = platformMicros();
+  unsigned long elapsedMicros = 0;
+  while (elapsedMicros < minDurationMicros)
+  {
+    int accumulator = 0;
+    uint32_t startCycles = platformCycleCount();
+    for (int i = 0; i < BENCHMARK_BATCH_SIZE; i++)
+    {
+      accumulator += operation();
+    }
+    cycles += (uint32_t)(platformCycleCount() - startCycles);
+    benchmarkSink += accumulator;
+    iterations += BENCHMARK_BATCH_SIZE;
+    elapsedMicros = platformMicros() - startMicros;
+  }
+
+  BenchmarkResult result;
+  result.name = name;
+  result.iterations = iterations;
+  result.nsPerOp = (elapsedMicros * 1000.0) / iterations;
+  result.cyclesPerOp = (double)cycles / iterations;
+  return result;
+}
+
+/**
+ * @brief Format a benchmark result as a CSV row
+ *    (name,iterations,ns_per_op,cycles_per_op).
+ * 
+ * @param result The result to format.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatBenchmarkResult(BenchmarkResult result, char *buffer, int size);
+
+/**
+ * @brief The CSV header matching formatBenchmarkResult.
+ */
+extern const char *BENCHMARK_CSV_HEADER;
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGBENCHMARK_H
@@ -0,0 +1,228 @@
+#include "BitBoard.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor, the set starts empty.
+ * 
+ * @param width The width of the board in cells.
+ * @param height The height of the board in cells.
+ */
+BitBoard::BitBoard(int16_t width, int16_t height)
+    : width(width),
+      // Never overrun the words, anything beyond is clipped
+      height(width * height > MAX_FRAME_PIXELS ? MAX_FRAME_PIXELS / width : height)
+{
+  wordCount = (this->width * this->height + 63) / 64;
+  clear();
+}
+
+/**
+ * @brief Remove every cell from the set.
+ */
+void BitBoard::clear()
+{
+  for (int i = 0; i < BITBOARD_MAX_WORDS; i++)
+  {
+    words[i] = 0;
+  }
+}
+
+/**
+ * @brief Add a cell to the set, cells off the board are ignored.
+ */
+void BitBoard::set(int16_t x, int16_t y)
+{
+  if (x < 0 || x >= width || y < 0 || y >= height)
+  {
+    return;
+  }
+  int index = y * width + x;
+  words[index >> 6] |= (uint64_t)1 << (index & 63);
+}
+
+/**
+ * @brief Check whether a cell is in the set.
+ */
+bool BitBoard::test(int16_t x, int16_t y)
+{
+  if (x < 0 || x >= width || y < 0 || y >= height)
+  {
+    return false;
+  }
+  int index = y * width + x;
+  return (words[index >> 6] >> (index & 63)) & 1;
+}
+
+/**
+ * @brief Add a rectangle of cells to the set, clipped to the board.
+ *    Each row of the rectangle is a run of consecutive cells.
+ */
+void BitBoard::fillRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  int16_t xMin = x < 0 ? 0 : x;
+  int16_t yMin = y < 0 ? 0 : y;
+  int16_t xMax = x + w > width ? width : x + w;
+  int16_t yMax = y + h > height ? height : y + h;
+  if (xMin >= xMax)
+  {
+    return;
+  }
+  for (int16_t j = yMin; j < yMax; j++)
+  {
+    setRange(j * width + xMin, xMax - xMin);
+  }
+}
+
+/**
+ * @brief Add every cell of another set (of the same size) to this one.
+ */
+void BitBoard::unite(BitBoard &other)
+{
+  for (int i = 0; i < wordCount; i++)
+  {
+    words[i] |= other.words[i];
+  }
+}
+
+/**
+ * @brief Keep only the cells that are also in another set (of the same size).
+ */
+void BitBoard::intersect(BitBoard &other)
+{
+  for (int i = 0; i < wordCount; i++)
+  {
+    words[i] &= other.words[i];
+  }
+}
+
+/**
+ * @brief Check whether any cell is in both this & another set (of the same size).
+ */
+bool BitBoard::intersects(BitBoard &other)
+{
+  for (int i = 0; i < wordCount; i++)
+  {
+    if (words[i] & other.words[i])
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Check whether the set is empty.
+ */
+bool BitBoard::isEmpty()
+{
+  for (int i = 0; i < wordCount; i++)
+  {
+    if (words[i] != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Count the cells in the set.
+ */
+int BitBoard::count()
+{
+  int cells = 0;
+  for (int i = 0; i < wordCount; i++)
+  {
+    cells += __builtin_popcountll(words[i]);
+  }
+  return cells;
+}
+
+/**
+ * @brief Draw every cell in the set onto a display.
+ *    Only visits the cells in the set, lowest first.
+ */
+void BitBoard::render(Display &display, uint16_t colour)
+{
+  for (int i = 0; i < wordCount; i++)
+  {
+    uint64_t word = words[i];
+    while (word != 0)
+    {
+      int index = (i << 6) + __builtin_ctzll(word);
+      display.drawPixel(index % width, index / width, colour);
+      // Clear the lowest set bit
+      word &= word - 1;
+    }
+  }
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the width of the board in cells.
+ */
+int16_t BitBoard::getWidth()
+{
+  return width;
+}
+
+/**
+ * @brief Get the height of the board in cells.
+ */
+int16_t BitBoard::getHeight()
+{
+  return height;
+}
+
+/**
+ * @brief Get the number of words used.
+ */
+int BitBoard::getWordCount()
+{
+  return wordCount;
+}
+
+/**
+ * @brief Get one of the words of the set, the first cell is the lowest bit.
+ */
+uint64_t BitBoard::getWord(int index)
+{
+  return index >= 0 && index < wordCount ? words[index] : 0;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+
+/**
+ * @brief Add a run of consecutive cells to the set, a word at a time.
+ */
+void BitBoard::setRange(int start, int length)
+{
+  while (length > 0)
+  {
+    int bit = start & 63;
+    int bits = 64 - bit < length ? 64 - bit : length;
+    uint64_t mask = bits == 64 ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1) << bit;
+    words[start >> 6] |= mask;
+    start += bits;
+    length -= bits;
+  }
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
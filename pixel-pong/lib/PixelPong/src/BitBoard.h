@@ -0,0 +1,180 @@
+#ifndef PONGBITBOARD_H
+#define PONGBITBOARD_H
+
+#include "Display.h"
+#include <stdint.h>
+
+/**
+ * @brief The number of 64-bit words a BitBoard can hold,
+ *    enough for a board of MAX_FRAME_PIXELS.
+ */
+#define BITBOARD_MAX_WORDS ((MAX_FRAME_PIXELS + 63) / 64)
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief A set of board cells, one bit per cell row by row.
+ *    An 8x8 board fits in a single 64-bit word, larger boards
+ *    use as many words as they need. Combining & testing sets
+ *    works on a whole word (64 cells) at a time.
+ */
+class BitBoard
+{
+public:
+  /**
+   * @brief Class constructor, the set starts empty.
+   * 
+   * @param width The width of the board in cells.
+   * @param height The height of the board in cells.
+   *    width * height must be no more than MAX_FRAME_PIXELS.
+   */
+  BitBoard(int16_t width, int16_t height);
+
+  /**
+   * @brief Remove every cell from the set.
+   */
+  void clear();
+
+  /**
+   * @brief Add a cell to the set, cells off the board are ignored.
+   * 
+   * @param x The X-coordinate of the cell.
+   * @param y The Y-coordinate of the cell.
+   */
+  void set(int16_t x, int16_t y);
+
+  /**
+   * @brief Check whether a cell is in the set.
+   * 
+   * @param x The X-coordinate of the cell.
+   * @param y The Y-coordinate of the cell.
+   * 
+   * @return Whether or not the cell is in the set, false if off the board.
+   */
+  bool test(int16_t x, int16_t y);
+
+  /**
+   * @brief Add a rectangle of cells to the set, clipped to the board.
+   * 
+   * @param x The X-coordinate of the top left corner.
+   * @param y The Y-coordinate of the top left corner.
+   * @param w The width of the rectangle.
+   * @param h The height of the rectangle.
+   */
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  /**
+   * @brief Add every cell of another set (of the same size) to this one.
+   * 
+   * @param other The other set.
+   */
+  void unite(BitBoard &other);
+
+  /**
+   * @brief Keep only the cells that are also in another set (of the same size).
+   * 
+   * @param other The other set.
+   */
+  void intersect(BitBoard &other);
+
+  /**
+   * @brief Check whether any cell is in both this & another set (of the same size).
+   * 
+   * @param other The other set.
+   * 
+   * @return Whether or not the sets overlap.
+   */
+  bool intersects(BitBoard &other);
+
+  /**
+   * @brief Check whether the set is empty.
+   */
+  bool isEmpty();
+
+  /**
+   * @brief Count the cells in the set.
+   */
+  int count();
+
+  /**
+   * @brief Draw every cell in the set onto a display.
+   * 
+   * @param display The display to draw onto.
+   * @param colour The RGB565 colour of the cells.
+   */
+  void render(Display &display, uint16_t colour);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the width of the board in cells.
+   */
+  int16_t getWidth();
+
+  /**
+   * @brief Get the height of the board in cells.
+   */
+  int16_t getHeight();
+
+  /**
+   * @brief Get the number of words used.
+   */
+  int getWordCount();
+
+  /**
+   * @brief Get one of the words of the set, the first cell is the lowest bit.
+   * 
+   * @param index The index of the word.
+   */
+  uint64_t getWord(int index);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The width of the board in cells.
+   */
+  int16_t width;
+
+  /**
+   * @brief The height of the board in cells.
+   */
+  int16_t height;
+
+  /**
+   * @brief The number of words used.
+   */
+  int wordCount;
+
+  /**
+   * @brief The cells, 64 per word.
+   */
+  uint64_t words[BITBOARD_MAX_WORDS];
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Add a run of consecutive cells to the set.
+   * 
+   * @param start The index of the first cell.
+   * @param length The number of cells.
+   */
+  void setRange(int start, int length);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGBITBOARD_H
@@ -43,6 +43,46 @@ bool Board::checkBoundaryCollision(Position position)
   return false;
 }
 
+/**
+ * @brief Find the first contact of a ball moving between two positions
+ *    with the boundary (top & bottom) of the board.
+ * 
+ * @param from The position of the ball at the start of the path.
+ * @param to The position of the ball at the end of the path.
+ * 
+ * @return The time and position of contact.
+ */
+SweptCollision Board::sweepBoundaryCollision(PrecisePosition from, PrecisePosition to)
+{
+  fixed_t dy = to.y - from.y;
+  fixed_t contactY;
+  // Moving up towards the top row
+  if (dy > 0 && to.y > intToFixed(yDim - 1))
+  {
+    contactY = intToFixed(yDim - 1);
+  }
+  // Moving down towards the bottom row
+  else if (dy < 0 && to.y < 0)
+  {
+    contactY = 0;
+  }
+  else
+  {
+    return SweptCollision::none();
+  }
+
+  fixed_t time = fixedDivide(contactY - from.y, dy);
+  // Starting beyond the boundary, push straight back
+  time = time < 0 ? 0 : time;
+
+  SweptCollision collision = {
+      true,
+      time,
+      PrecisePosition(from.x + fixedMultiply(to.x - from.x, time), contactY),
+      NO_COLLISION};
+  return collision;
+}
+
 bool Board::checkWinState(Position position)
 {
   // TODO - may need to tweak this for handling corners
@@ -58,6 +98,18 @@ bool Board::checkWinState(Position position)
   return false;
 }
 
+/**
+ * @brief Add the cells the ball rebounds off (the top & bottom rows)
+ *    to a BitBoard.
+ * 
+ * @param mask The BitBoard to add the cells to.
+ */
+void Board::fillBoundaryMask(BitBoard &mask)
+{
+  mask.fillRect(0, 0, xDim, 1);
+  mask.fillRect(0, yDim - 1, xDim, 1);
+}
+
 /**
  * _____________ GETTERS
  */
@@ -87,3 +139,17 @@ int Board::getYDim()
  * ----------------------------------------------------------------------------------------------------------------- 
  * =================================================================================================================
 */
+
+/**
+ * @brief Calculate the valid Y coordinate for paddles based on their size,
+ *    anchor point and the board size.
+ * 
+ * @param board The game board.
+ * @param paddle A paddle used in the game (assumes both game paddles are the same)
+ * 
+ * @return The valid Y coordinates.
+ */
+PaddlePositions getValidPaddlePositions(Board &board, Paddle &paddle)
+{
+  return makePaddlePositions(board.getYDim(), paddle.getSize(), paddle.getAnchorIndex());
+}
@@ -5,6 +5,33 @@
 #include "Ball.h"
 #include "Paddle.h"
 
+/**
+ * @brief The maximum number of valid positions a paddle can have,
+ *    i.e. the maximum supported board height.
+ */
+#define MAX_PADDLE_POSITIONS 64
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Fixed capacity list of the valid Y coordinates of a paddle,
+ *    so reading them never touches the heap.
+ */
+struct PaddlePositions
+{
+  int positions[MAX_PADDLE_POSITIONS]; /// The valid Y coordinates, lowest first.
+  int count;                           /// The number of valid Y coordinates.
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
 /**
  * ==================================================================================================================
  * ~                                                  CLASS                                                    
@@ -46,6 +73,20 @@ public:
    */
   bool checkBoundaryCollision(Position position);
 
+  /**
+   * @brief Find the first contact of a ball moving between two positions
+   *    with the boundary (top & bottom) of the board.
+   *    The ball is treated as a pixel sized square, so contact is made when
+   *    its centre reaches the centre of the top or bottom row.
+   * 
+   * @param from The position of the ball at the start of the path.
+   * @param to The position of the ball at the end of the path.
+   * 
+   * @return The time and position of contact.
+   *    @see SweptCollision
+   */
+  SweptCollision sweepBoundaryCollision(PrecisePosition from, PrecisePosition to);
+
   /**
    * @brief Check whether a given position is a win state
    *     (left & right) of the board.
@@ -54,6 +95,14 @@ public:
    */
   bool checkWinState(Position position);
 
+  /**
+   * @brief Add the cells the ball rebounds off (the top & bottom rows)
+   *    to a BitBoard.
+   * 
+   * @param mask The BitBoard to add the cells to.
+   */
+  void fillBoundaryMask(BitBoard &mask);
+
   /**
    * _____________ GETTERS
    */
@@ -110,4 +159,41 @@ private:
  * =================================================================================================================
 */
 
+/**
+ * @brief Calculate the valid Y coordinate for paddles based on their size,
+ *    anchor point and the board size.
+ * 
+ * @param board The game board.
+ * @param paddle A paddle used in the game (assumes both game paddles are the same)
+ * 
+ * @return The valid Y coordinates.
+ */
+PaddlePositions getValidPaddlePositions(Board &board, Paddle &paddle);
+
+/**
+ * @brief Calculate the valid Y coordinates for paddles based on their size,
+ *    anchor point and the board height. Can be evaluated at compile time.
+ *    @see GameGeometry
+ * 
+ * @param boardY The Y-dimension of the board.
+ * @param paddleSize The size of the paddles in pixels.
+ * @param paddleAnchor The anchor of the paddles @see Paddle::Paddle
+ * 
+ * @return The valid Y coordinates.
+ */
+constexpr PaddlePositions makePaddlePositions(int boardY, int paddleSize, int paddleAnchor)
+{
+  int maxY = (boardY - 1) - (paddleSize - 1 - paddleAnchor);
+  int minY = paddleAnchor;
+  int yRange = (maxY - minY) + 1;
+
+  PaddlePositions validPositions = {};
+  validPositions.count = yRange < MAX_PADDLE_POSITIONS ? yRange : MAX_PADDLE_POSITIONS;
+  for (int i = 0; i < validPositions.count; i++)
+  {
+    validPositions.positions[i] = minY + i;
+  }
+  return validPositions;
+}
+
 #endif // PONGBOARD_H
@@ -0,0 +1,182 @@
+#include "DeadlineMonitor.h"
+#include <stdio.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param periodMicros The period of the timer in microseconds.
+ */
+DeadlineMonitor::DeadlineMonitor(uint32_t periodMicros) : periodMicros(periodMicros)
+{
+  reset();
+}
+
+/**
+ * @brief Record an event being serviced.
+ *    An interval between events of around n periods means n - 1 were missed.
+ * 
+ * @param firedMicros When the timer fired (platform micros).
+ * @param nowMicros When the event is being serviced (platform micros).
+ */
+void DeadlineMonitor::serviced(uint32_t firedMicros, uint32_t nowMicros)
+{
+  // Unsigned differences cope with the micros counter wrapping
+  uint32_t lagMicros = nowMicros - firedMicros;
+  lag.record(lagMicros);
+  if (lagMicros > periodMicros)
+  {
+    lateCount++;
+  }
+
+  if (lastFiredValid)
+  {
+    uint32_t intervalMicros = firedMicros - lastFiredMicros;
+    jitter.record(intervalMicros > periodMicros ? intervalMicros - periodMicros : periodMicros - intervalMicros);
+    uint32_t periods = (intervalMicros + periodMicros / 2) / periodMicros;
+    if (periods > 1)
+    {
+      missedCount += periods - 1;
+    }
+  }
+  lastFiredMicros = firedMicros;
+  lastFiredValid = true;
+  servicedCount++;
+}
+
+/**
+ * @brief Record events that were serviced along with another,
+ *    e.g. several ticks handled in one wake up.
+ * 
+ * @param count The number of extra events.
+ */
+void DeadlineMonitor::coalesced(uint32_t count)
+{
+  coalescedCount += count;
+}
+
+/**
+ * @brief Discard everything recorded.
+ */
+void DeadlineMonitor::reset()
+{
+  lastFiredMicros = 0;
+  lastFiredValid = false;
+  servicedCount = 0;
+  lateCount = 0;
+  missedCount = 0;
+  coalescedCount = 0;
+  lag.reset();
+  jitter.reset();
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the period of the timer in microseconds.
+ */
+uint32_t DeadlineMonitor::getPeriodMicros()
+{
+  return periodMicros;
+}
+
+/**
+ * @brief Get the number of events serviced.
+ */
+uint32_t DeadlineMonitor::getServicedCount()
+{
+  return servicedCount;
+}
+
+/**
+ * @brief Get the number of events serviced more than a period after they fired.
+ */
+uint32_t DeadlineMonitor::getLateCount()
+{
+  return lateCount;
+}
+
+/**
+ * @brief Get the number of whole periods that passed without an event.
+ */
+uint32_t DeadlineMonitor::getMissedCount()
+{
+  return missedCount;
+}
+
+/**
+ * @brief Get the number of events serviced along with another.
+ */
+uint32_t DeadlineMonitor::getCoalescedCount()
+{
+  return coalescedCount;
+}
+
+/**
+ * @brief Get the microseconds between each event firing and being serviced.
+ */
+LatencyHistogram &DeadlineMonitor::getLag()
+{
+  return lag;
+}
+
+/**
+ * @brief Get the microseconds each interval between events was off the period by.
+ */
+LatencyHistogram &DeadlineMonitor::getJitter()
+{
+  return jitter;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+const char *DEADLINE_CSV_HEADER = "timer,period_us,serviced,late,missed,coalesced,dropped,"
+                                  "lag_p50_us,lag_p99_us,lag_max_us,jitter_p50_us,jitter_p99_us,jitter_max_us";
+
+/**
+ * @brief Format a monitor's counts & p50/p99/max lag and jitter as a CSV row
+ *    (timer,period_us,serviced,late,missed,coalesced,dropped,lag_p50_us,lag_p99_us,lag_max_us,
+ *    jitter_p50_us,jitter_p99_us,jitter_max_us).
+ * 
+ * @param name Name of the timer.
+ * @param monitor The monitor.
+ * @param droppedCount Events dropped before they could be serviced (e.g. a full queue).
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatDeadlineMonitor(const char *name, DeadlineMonitor &monitor, uint32_t droppedCount, char *buffer, int size)
+{
+  LatencyHistogram &lag = monitor.getLag();
+  LatencyHistogram &jitter = monitor.getJitter();
+  snprintf(buffer, size, "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", name,
+           (unsigned long)monitor.getPeriodMicros(), (unsigned long)monitor.getServicedCount(),
+           (unsigned long)monitor.getLateCount(), (unsigned long)monitor.getMissedCount(),
+           (unsigned long)monitor.getCoalescedCount(), (unsigned long)droppedCount,
+           (unsigned long)lag.percentile(500), (unsigned long)lag.percentile(990), (unsigned long)lag.getMax(),
+           (unsigned long)jitter.percentile(500), (unsigned long)jitter.percentile(990), (unsigned long)jitter.getMax());
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,158 @@
+#ifndef PONGDEADLINEMONITOR_H
+#define PONGDEADLINEMONITOR_H
+
+#include "LatencyHistogram.h"
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Tracks how well the events of a periodic timer are serviced.
+ *    Given when each event fired and when it was serviced it keeps the
+ *    lag between the two, the jitter of the timer (how far each interval
+ *    between events is from the period) and counts of events serviced
+ *    late (after the next was due), missed (a whole period with no event)
+ *    and coalesced (serviced together with another in one wake up).
+ *    Updated by the task servicing the events, anything reading it from
+ *    another should hold whatever lock that task holds.
+ */
+class DeadlineMonitor
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param periodMicros The period of the timer in microseconds.
+   */
+  DeadlineMonitor(uint32_t periodMicros);
+
+  /**
+   * @brief Record an event being serviced.
+   * 
+   * @param firedMicros When the timer fired (platform micros).
+   * @param nowMicros When the event is being serviced (platform micros).
+   */
+  void serviced(uint32_t firedMicros, uint32_t nowMicros);
+
+  /**
+   * @brief Record events that were serviced along with another,
+   *    e.g. several ticks handled in one wake up.
+   * 
+   * @param count The number of extra events.
+   */
+  void coalesced(uint32_t count);
+
+  /**
+   * @brief Discard everything recorded.
+   */
+  void reset();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the period of the timer in microseconds.
+   */
+  uint32_t getPeriodMicros();
+
+  /**
+   * @brief Get the number of events serviced.
+   */
+  uint32_t getServicedCount();
+
+  /**
+   * @brief Get the number of events serviced more than a period after they fired.
+   */
+  uint32_t getLateCount();
+
+  /**
+   * @brief Get the number of whole periods that passed without an event.
+   */
+  uint32_t getMissedCount();
+
+  /**
+   * @brief Get the number of events serviced along with another.
+   */
+  uint32_t getCoalescedCount();
+
+  /**
+   * @brief Get the microseconds between each event firing and being serviced.
+   */
+  LatencyHistogram &getLag();
+
+  /**
+   * @brief Get the microseconds each interval between events was off the period by.
+   */
+  LatencyHistogram &getJitter();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The period of the timer in microseconds.
+   */
+  uint32_t periodMicros;
+
+  /**
+   * @brief When the last event serviced fired, valid once one has been.
+   */
+  uint32_t lastFiredMicros;
+  bool lastFiredValid;
+
+  /**
+   * @brief Counts of the events serviced, and how.
+   */
+  uint32_t servicedCount;
+  uint32_t lateCount;
+  uint32_t missedCount;
+  uint32_t coalescedCount;
+
+  /**
+   * @brief The lag & jitter of each event, in microseconds.
+   */
+  LatencyHistogram lag;
+  LatencyHistogram jitter;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Format a monitor's counts & p50/p99/max lag and jitter as a CSV row
+ *    (timer,period_us,serviced,late,missed,coalesced,dropped,lag_p50_us,lag_p99_us,lag_max_us,
+ *    jitter_p50_us,jitter_p99_us,jitter_max_us).
+ * 
+ * @param name Name of the timer.
+ * @param monitor The monitor.
+ * @param droppedCount Events dropped before they could be serviced (e.g. a full queue).
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatDeadlineMonitor(const char *name, DeadlineMonitor &monitor, uint32_t droppedCount, char *buffer, int size);
+
+/**
+ * @brief The CSV header matching formatDeadlineMonitor.
+ */
+extern const char *DEADLINE_CSV_HEADER;
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGDEADLINEMONITOR_H
@@ -0,0 +1,76 @@
+#include "Display.h"
+
+// Adafruit_NeoMatrix's gamma5 curve, for the 5 bit red & blue and (interpolated) the 6 bit green of RGB565
+static const uint8_t gamma5[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0e, 0x11, 0x14, 0x18, 0x1d, 0x22, 0x28, 0x2e,
+    0x36, 0x3d, 0x46, 0x4f, 0x59, 0x64, 0x6f, 0x7c, 0x89, 0x97, 0xa6, 0xb6, 0xc7, 0xd9, 0xeb, 0xff};
+static const uint8_t gamma6[64] = {
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+    0x0e, 0x0f, 0x11, 0x12, 0x14, 0x15, 0x17, 0x1a, 0x1c, 0x1f, 0x21, 0x24, 0x27, 0x2a, 0x2d, 0x30,
+    0x34, 0x38, 0x3b, 0x3f, 0x43, 0x48, 0x4c, 0x51, 0x56, 0x5b, 0x60, 0x66, 0x6b, 0x71, 0x77, 0x7e,
+    0x84, 0x8b, 0x91, 0x98, 0xa0, 0xa7, 0xaf, 0xb7, 0xbf, 0xc8, 0xd1, 0xda, 0xe2, 0xeb, 0xf5, 0xff};
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Fill a rectangle of the pending frame.
+ *    Defaults to drawing each pixel in turn.
+ */
+void Display::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+  for (int16_t i = x; i < x + w; i++)
+  {
+    for (int16_t j = y; j < y + h; j++)
+    {
+      drawPixel(i, j, colour);
+    }
+  }
+}
+
+/**
+ * @brief Pack 8-bit RGB values into a RGB565 colour.
+ * 
+ * @return The packed colour.
+ */
+uint16_t Display::colour(uint8_t r, uint8_t g, uint8_t b)
+{
+  return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+}
+
+/**
+ * @brief Unpack a RGB565 colour into 8-bit RGB values.
+ */
+void Display::colourComponents(uint16_t colour, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+  uint8_t r5 = (colour >> 11) & 0x1F;
+  uint8_t g6 = (colour >> 5) & 0x3F;
+  uint8_t b5 = colour & 0x1F;
+  r = (r5 << 3) | (r5 >> 2);
+  g = (g6 << 2) | (g6 >> 4);
+  b = (b5 << 3) | (b5 >> 2);
+}
+
+/**
+ * @brief Unpack a RGB565 colour into 8-bit RGB values for LEDs, gamma
+ *    expanded as Adafruit_NeoMatrix does so colours look the same on
+ *    the matrix as they always have (a linear unpack washes them out).
+ */
+void Display::ledComponents(uint16_t colour, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+  r = gamma5[(colour >> 11) & 0x1F];
+  g = gamma6[(colour >> 5) & 0x3F];
+  b = gamma5[colour & 0x1F];
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,103 @@
+#ifndef PONGDISPLAY_H
+#define PONGDISPLAY_H
+
+#include <stdint.h>
+
+/**
+ * @brief The largest frame (width * height) the buffering displays can hold.
+ */
+#ifndef MAX_FRAME_PIXELS
+#define MAX_FRAME_PIXELS 2048 // 64x32
+#endif
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Interface for anything the game can be rendered onto.
+ *    Keeps the game library independent of the LED hardware so it
+ *    can be built and run natively.
+ *    Colours are 16-bit RGB565, matching Adafruit_GFX.
+ */
+class Display
+{
+public:
+  virtual ~Display() {}
+
+  /**
+   * @brief Clear every pixel of the display (in the pending frame).
+   */
+  virtual void clear() = 0;
+
+  /**
+   * @brief Set a single pixel of the pending frame.
+   * 
+   * @param x The X-coordinate of the pixel.
+   * @param y The Y-coordinate of the pixel.
+   * @param colour The RGB565 colour of the pixel.
+   */
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t colour) = 0;
+
+  /**
+   * @brief Fill a rectangle of the pending frame.
+   *    Defaults to drawing each pixel in turn.
+   * 
+   * @param x The X-coordinate of the top left corner.
+   * @param y The Y-coordinate of the top left corner.
+   * @param w The width of the rectangle.
+   * @param h The height of the rectangle.
+   * @param colour The RGB565 colour of the rectangle.
+   */
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  /**
+   * @brief Push the pending frame out to the display.
+   */
+  virtual void show() = 0;
+
+  /**
+   * @brief Pack 8-bit RGB values into a RGB565 colour.
+   *    Same packing as Adafruit_NeoMatrix::Color.
+   * 
+   * @param r The red component (0 - 255).
+   * @param g The green component (0 - 255).
+   * @param b The blue component (0 - 255).
+   * 
+   * @return The packed colour.
+   */
+  static uint16_t colour(uint8_t r, uint8_t g, uint8_t b);
+
+  /**
+   * @brief Unpack a RGB565 colour into 8-bit RGB values.
+   *    The low bits are filled from the high bits, so full
+   *    intensity unpacks to 255.
+   * 
+   * @param colour The packed colour.
+   * @param r Set to the red component (0 - 255).
+   * @param g Set to the green component (0 - 255).
+   * @param b Set to the blue component (0 - 255).
+   */
+  static void colourComponents(uint16_t colour, uint8_t &r, uint8_t &g, uint8_t &b);
+
+  /**
+   * @brief Unpack a RGB565 colour into 8-bit RGB values for LEDs, gamma
+   *    expanded as Adafruit_NeoMatrix does so colours look the same on
+   *    the matrix as they always have (a linear unpack washes them out).
+   * 
+   * @param colour The packed colour.
+   * @param r Set to the red component (0 - 255).
+   * @param g Set to the green component (0 - 255).
+   * @param b Set to the blue component (0 - 255).
+   */
+  static void ledComponents(uint16_t colour, uint8_t &r, uint8_t &g, uint8_t &b);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGDISPLAY_H
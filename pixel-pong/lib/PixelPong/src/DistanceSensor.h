@@ -0,0 +1,47 @@
+#ifndef PONGDISTANCESENSOR_H
+#define PONGDISTANCESENSOR_H
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Interface for a distance sensor used as a paddle controller.
+ *    Measurements happen in the background: trigger() starts one and
+ *    returns immediately, getDistance() hands back the latest completed one.
+ *    Neither call may block.
+ */
+class DistanceSensor
+{
+public:
+  virtual ~DistanceSensor() {}
+
+  /**
+   * @brief Set up the sensor (pins, interrupts etc.).
+   */
+  virtual void begin() {}
+
+  /**
+   * @brief Start a new measurement in the background.
+   */
+  virtual void trigger() = 0;
+
+  /**
+   * @brief Get the latest completed measurement.
+   * 
+   * @param distance Set to the measured distance in cm.
+   * 
+   * @return Whether or not a recent measurement was available,
+   *    distance is left untouched if not.
+   */
+  virtual bool getDistance(int &distance) = 0;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGDISTANCESENSOR_H
@@ -0,0 +1,123 @@
+#ifdef ARDUINO
+
+#include "EchoSensor.h"
+#include "Trace.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param triggerPin The trigger pin number of the sensor.
+ * @param echoPin The echo pin number of the sensor.
+ * @param maxAgeMicros How old the latest measurement can be before
+ *    it is considered lost (i.e. the echo never came back).
+ */
+EchoSensor::EchoSensor(int triggerPin, int echoPin, unsigned long maxAgeMicros)
+    : triggerPin(triggerPin),
+      echoPin(echoPin),
+      maxAgeMicros(maxAgeMicros),
+      echoStartMicros(0),
+      pulseWidthMicros(0),
+      pulseEndMicros(0),
+      pulseMux(portMUX_INITIALIZER_UNLOCKED) {}
+
+/**
+ * @brief Set up the pins and attach the echo interrupt.
+ *    The interrupt is serviced on the core the first GPIO interrupt was
+ *    attached from, not necessarily this one.
+ */
+void EchoSensor::begin()
+{
+  pinMode(echoPin, INPUT);
+  pinMode(triggerPin, OUTPUT);
+  digitalWrite(triggerPin, LOW);
+  attachInterruptArg(echoPin, handleEcho, this, CHANGE);
+}
+
+/**
+ * @brief Send the trigger pulse, the echo is captured by the interrupt handler.
+ */
+void EchoSensor::trigger()
+{
+  // The sensor ignores triggers while an echo is in progress.
+  if (digitalRead(echoPin) == HIGH)
+  {
+    return;
+  }
+  // Under the lock, the echo interrupt may be using it on the other core
+  portENTER_CRITICAL(&pulseMux);
+  echoStartMicros = 0;
+  portEXIT_CRITICAL(&pulseMux);
+  digitalWrite(triggerPin, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(triggerPin, LOW);
+}
+
+/**
+ * @brief Get the latest completed measurement.
+ * 
+ * @param distance Set to the measured distance in cm.
+ * 
+ * @return Whether or not a recent measurement was available.
+ */
+bool EchoSensor::getDistance(int &distance)
+{
+  // Copy out under the lock so the width and end time are from the same pulse.
+  portENTER_CRITICAL(&pulseMux);
+  unsigned long width = pulseWidthMicros;
+  unsigned long end = pulseEndMicros;
+  portEXIT_CRITICAL(&pulseMux);
+
+  if (end == 0 || micros() - end > maxAgeMicros)
+  {
+    return false;
+  }
+  // Speed of sound is 0.034 cm/us, halved as the pulse travels there and back.
+  distance = (width * 17) / 1000;
+  return true;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+/**
+ * @brief Interrupt handler for both edges of the echo pin.
+ *    Kept to integer maths, the FPU can't be used in interrupts.
+ * 
+ * @param sensor The EchoSensor the interrupt belongs to.
+ */
+void IRAM_ATTR EchoSensor::handleEcho(void *sensor)
+{
+  TRACE_SCOPE(TRACE_ECHO_INTERRUPT);
+  EchoSensor *self = (EchoSensor *)sensor;
+  unsigned long now = micros();
+  portENTER_CRITICAL_ISR(&self->pulseMux);
+  if (digitalRead(self->echoPin) == HIGH)
+  {
+    self->echoStartMicros = now;
+  }
+  else if (self->echoStartMicros != 0)
+  {
+    self->pulseWidthMicros = now - self->echoStartMicros;
+    self->pulseEndMicros = now;
+    self->echoStartMicros = 0;
+  }
+  portEXIT_CRITICAL_ISR(&self->pulseMux);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
@@ -0,0 +1,108 @@
+#ifndef PONGECHOSENSOR_H
+#define PONGECHOSENSOR_H
+
+#ifdef ARDUINO
+
+#include "DistanceSensor.h"
+#include <Arduino.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief HC-SR04 ultrasonic sensor measured with edge capture rather than pulseIn.
+ *    A GPIO interrupt on both edges of the echo pin timestamps the pulse,
+ *    so a missing echo never stalls the caller.
+ *    Only available when building for the device.
+ */
+class EchoSensor : public DistanceSensor
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param triggerPin The trigger pin number of the sensor.
+   * @param echoPin The echo pin number of the sensor.
+   * @param maxAgeMicros How old the latest measurement can be before
+   *    it is considered lost (i.e. the echo never came back).
+   */
+  EchoSensor(int triggerPin, int echoPin, unsigned long maxAgeMicros = 250000);
+
+  /**
+   * @brief Set up the pins and attach the echo interrupt.
+   *    The interrupt is serviced on the core the first GPIO interrupt was
+   *    attached from, not necessarily this one.
+   */
+  void begin();
+
+  void trigger();
+
+  bool getDistance(int &distance);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The trigger pin number of the sensor.
+   */
+  int triggerPin;
+
+  /**
+   * @brief The echo pin number of the sensor.
+   */
+  int echoPin;
+
+  /**
+   * @brief How old the latest measurement can be before it is considered lost.
+   */
+  unsigned long maxAgeMicros;
+
+  /**
+   * @brief Time of the rising edge of the echo in progress, 0 if none.
+   *    Written by the interrupt handler.
+   */
+  volatile unsigned long echoStartMicros;
+
+  /**
+   * @brief Width of the latest complete echo pulse.
+   *    Written by the interrupt handler.
+   */
+  volatile unsigned long pulseWidthMicros;
+
+  /**
+   * @brief Time the latest complete echo pulse ended, 0 if none yet.
+   *    Written by the interrupt handler.
+   */
+  volatile unsigned long pulseEndMicros;
+
+  /**
+   * @brief Guards the pulse fields against the interrupt handler,
+   *    which may be running on the other core.
+   */
+  portMUX_TYPE pulseMux;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Interrupt handler for both edges of the echo pin.
+   * 
+   * @param sensor The EchoSensor the interrupt belongs to.
+   */
+  static void IRAM_ATTR handleEcho(void *sensor);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
+
+#endif // PONGECHOSENSOR_H
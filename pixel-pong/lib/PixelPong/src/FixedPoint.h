@@ -0,0 +1,93 @@
+#ifndef PONGFIXEDPOINT_H
+#define PONGFIXEDPOINT_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                             FIXED POINT                                                   
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Signed Q15.16 fixed point number, used for sub-pixel positions
+ *    and velocities. Integer maths only, so it is cheap on the ESP32 and
+ *    bit-for-bit identical on every platform.
+ */
+typedef int32_t fixed_t;
+
+#define FIXED_FRACTION_BITS 16                          // Number of fractional bits.
+#define FIXED_ONE ((fixed_t)1 << FIXED_FRACTION_BITS)   // 1.0 in fixed point.
+#define FIXED_HALF ((fixed_t)1 << (FIXED_FRACTION_BITS - 1)) // 0.5 in fixed point.
+
+/**
+ * @brief Convert a whole number to fixed point.
+ */
+inline fixed_t intToFixed(int value)
+{
+  return (fixed_t)value * FIXED_ONE;
+}
+
+/**
+ * @brief Convert a floating point number to fixed point (for configuration,
+ *    not to be used in the game tick).
+ */
+inline fixed_t floatToFixed(double value)
+{
+  return (fixed_t)(value * FIXED_ONE + (value < 0 ? -0.5 : 0.5));
+}
+
+/**
+ * @brief Convert a fixed point number to a floating point one (for reporting).
+ */
+inline double fixedToFloat(fixed_t value)
+{
+  return (double)value / FIXED_ONE;
+}
+
+/**
+ * @brief Round a fixed point number down to a whole number.
+ */
+inline int fixedFloor(fixed_t value)
+{
+  return (int)(value >> FIXED_FRACTION_BITS);
+}
+
+/**
+ * @brief Round a fixed point number to the nearest whole number (halves round up).
+ */
+inline int fixedRound(fixed_t value)
+{
+  return (int)((value + FIXED_HALF) >> FIXED_FRACTION_BITS);
+}
+
+/**
+ * @brief Get the absolute value of a fixed point number.
+ */
+inline fixed_t fixedAbs(fixed_t value)
+{
+  return value < 0 ? -value : value;
+}
+
+/**
+ * @brief Multiply two fixed point numbers.
+ */
+inline fixed_t fixedMultiply(fixed_t a, fixed_t b)
+{
+  return (fixed_t)(((int64_t)a * b) >> FIXED_FRACTION_BITS);
+}
+
+/**
+ * @brief Divide two fixed point numbers. b must not be 0.
+ */
+inline fixed_t fixedDivide(fixed_t a, fixed_t b)
+{
+  return (fixed_t)(((int64_t)a * FIXED_ONE) / b);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGFIXEDPOINT_H
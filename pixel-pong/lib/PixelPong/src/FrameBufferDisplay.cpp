@@ -0,0 +1,135 @@
+#include "FrameBufferDisplay.h"
+#include <string.h>
+
+/**
+ * @brief FNV-1a offset basis & prime (32-bit).
+ */
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param width The width of the display in pixels.
+ * @param height The height of the display in pixels.
+ */
+FrameBufferDisplay::FrameBufferDisplay(int16_t width, int16_t height)
+    : width(width),
+      // Never overrun the buffer, anything beyond is clipped
+      height(width * height > MAX_FRAME_PIXELS ? MAX_FRAME_PIXELS / width : height),
+      showCount(0),
+      frameHash(FNV_OFFSET_BASIS)
+{
+  memset(frame, 0, sizeof(frame));
+}
+
+void FrameBufferDisplay::clear()
+{
+  memset(frame, 0, sizeof(uint16_t) * width * height);
+}
+
+void FrameBufferDisplay::drawPixel(int16_t x, int16_t y, uint16_t colour)
+{
+  if (x < 0 || x >= width || y < 0 || y >= height)
+  {
+    return;
+  }
+  frame[y * width + x] = colour;
+}
+
+void FrameBufferDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+  // Clip to the display
+  int16_t xMin = x < 0 ? 0 : x;
+  int16_t yMin = y < 0 ? 0 : y;
+  int16_t xMax = x + w > width ? width : x + w;
+  int16_t yMax = y + h > height ? height : y + h;
+  for (int16_t j = yMin; j < yMax; j++)
+  {
+    for (int16_t i = xMin; i < xMax; i++)
+    {
+      frame[j * width + i] = colour;
+    }
+  }
+}
+
+/**
+ * @brief Fold the frame into the running hash.
+ */
+void FrameBufferDisplay::show()
+{
+  int pixelCount = width * height;
+  for (int i = 0; i < pixelCount; i++)
+  {
+    frameHash = (frameHash ^ (frame[i] & 0xFF)) * FNV_PRIME;
+    frameHash = (frameHash ^ (frame[i] >> 8)) * FNV_PRIME;
+  }
+  showCount++;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the width of the display in pixels.
+ */
+int16_t FrameBufferDisplay::getWidth()
+{
+  return width;
+}
+
+/**
+ * @brief Get the height of the display in pixels.
+ */
+int16_t FrameBufferDisplay::getHeight()
+{
+  return height;
+}
+
+/**
+ * @brief Get the colour of a pixel of the frame.
+ * 
+ * @param x The X-coordinate of the pixel.
+ * @param y The Y-coordinate of the pixel.
+ * 
+ * @return The RGB565 colour of the pixel, 0 if off the display.
+ */
+uint16_t FrameBufferDisplay::getPixel(int16_t x, int16_t y)
+{
+  if (x < 0 || x >= width || y < 0 || y >= height)
+  {
+    return 0;
+  }
+  return frame[y * width + x];
+}
+
+/**
+ * @brief Get the number of frames that have been shown.
+ */
+unsigned long FrameBufferDisplay::getShowCount()
+{
+  return showCount;
+}
+
+/**
+ * @brief Get the hash (32-bit FNV-1a) of every frame shown so far.
+ */
+uint32_t FrameBufferDisplay::getFrameHash()
+{
+  return frameHash;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,110 @@
+#ifndef PONGFRAMEBUFFERDISPLAY_H
+#define PONGFRAMEBUFFERDISPLAY_H
+
+#include "Display.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display that renders into an in-memory framebuffer.
+ *    Lets the output be inspected without any hardware, each frame
+ *    shown is folded into a running hash so a whole run can be
+ *    compared against a known good (golden) value.
+ *    Subclasses can override show() to dump the frame somewhere.
+ */
+class FrameBufferDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param width The width of the display in pixels.
+   * @param height The height of the display in pixels.
+   *    width * height must be no more than MAX_FRAME_PIXELS.
+   */
+  FrameBufferDisplay(int16_t width, int16_t height);
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  void show();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the width of the display in pixels.
+   */
+  int16_t getWidth();
+
+  /**
+   * @brief Get the height of the display in pixels.
+   */
+  int16_t getHeight();
+
+  /**
+   * @brief Get the colour of a pixel of the frame.
+   * 
+   * @param x The X-coordinate of the pixel.
+   * @param y The Y-coordinate of the pixel.
+   * 
+   * @return The RGB565 colour of the pixel, 0 if off the display.
+   */
+  uint16_t getPixel(int16_t x, int16_t y);
+
+  /**
+   * @brief Get the number of frames that have been shown.
+   */
+  unsigned long getShowCount();
+
+  /**
+   * @brief Get the hash (32-bit FNV-1a) of every frame shown so far.
+   */
+  uint32_t getFrameHash();
+
+protected:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The width of the display in pixels.
+   */
+  int16_t width;
+
+  /**
+   * @brief The height of the display in pixels.
+   */
+  int16_t height;
+
+  /**
+   * @brief The frame, row by row.
+   */
+  uint16_t frame[MAX_FRAME_PIXELS];
+
+private:
+  /**
+   * @brief The number of frames that have been shown.
+   */
+  unsigned long showCount;
+
+  /**
+   * @brief The hash of every frame shown so far.
+   */
+  uint32_t frameHash;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGFRAMEBUFFERDISPLAY_H
@@ -0,0 +1,131 @@
+#include "FrameDiffDisplay.h"
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param target The display frames are pushed to.
+ * @param width The width of the display in pixels.
+ * @param height The height of the display in pixels.
+ */
+FrameDiffDisplay::FrameDiffDisplay(Display &target, int16_t width, int16_t height)
+    : target(target),
+      width(width),
+      // Never overrun the buffers, anything beyond is clipped
+      height(width * height > MAX_FRAME_PIXELS ? MAX_FRAME_PIXELS / width : height),
+      shownFrameValid(false),
+      pushCount(0),
+      skippedPushCount(0),
+      pixelsWrittenCount(0)
+{
+  memset(frame, 0, sizeof(frame));
+  memset(shownFrame, 0, sizeof(shownFrame));
+}
+
+void FrameDiffDisplay::clear()
+{
+  memset(frame, 0, sizeof(uint16_t) * width * height);
+}
+
+void FrameDiffDisplay::drawPixel(int16_t x, int16_t y, uint16_t colour)
+{
+  if (x < 0 || x >= width || y < 0 || y >= height)
+  {
+    return;
+  }
+  frame[y * width + x] = colour;
+}
+
+void FrameDiffDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+  // Clip to the display
+  int16_t xMin = x < 0 ? 0 : x;
+  int16_t yMin = y < 0 ? 0 : y;
+  int16_t xMax = x + w > width ? width : x + w;
+  int16_t yMax = y + h > height ? height : y + h;
+  for (int16_t j = yMin; j < yMax; j++)
+  {
+    for (int16_t i = xMin; i < xMax; i++)
+    {
+      frame[j * width + i] = colour;
+    }
+  }
+}
+
+/**
+ * @brief Write the pixels that have changed since the last push through
+ *    to the target and show them, or skip the push if none have.
+ */
+void FrameDiffDisplay::show()
+{
+  int pixelCount = width * height;
+  if (shownFrameValid && memcmp(frame, shownFrame, sizeof(uint16_t) * pixelCount) == 0)
+  {
+    skippedPushCount++;
+    return;
+  }
+
+  for (int i = 0; i < pixelCount; i++)
+  {
+    if (!shownFrameValid || frame[i] != shownFrame[i])
+    {
+      target.drawPixel(i % width, i / width, frame[i]);
+      shownFrame[i] = frame[i];
+      pixelsWrittenCount++;
+    }
+  }
+  shownFrameValid = true;
+  target.show();
+  pushCount++;
+}
+
+/**
+ * @brief Forget what the target is showing, so the next frame is
+ *    pushed in full (e.g. after drawing onto the target directly).
+ */
+void FrameDiffDisplay::invalidate()
+{
+  shownFrameValid = false;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of frames pushed to the target.
+ */
+unsigned long FrameDiffDisplay::getPushCount()
+{
+  return pushCount;
+}
+
+/**
+ * @brief Get the number of frames not pushed as nothing had changed.
+ */
+unsigned long FrameDiffDisplay::getSkippedPushCount()
+{
+  return skippedPushCount;
+}
+
+/**
+ * @brief Get the number of pixels written through to the target.
+ */
+unsigned long FrameDiffDisplay::getPixelsWrittenCount()
+{
+  return pixelsWrittenCount;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,122 @@
+#ifndef PONGFRAMEDIFFDISPLAY_H
+#define PONGFRAMEDIFFDISPLAY_H
+
+#include "Display.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display that sits in front of another and only pushes frames
+ *    that have changed.
+ *    Frames are drawn into a shadow framebuffer, on show() it is compared
+ *    with the last frame pushed: only the pixels that changed are written
+ *    through, and the target's show() is skipped entirely if none did.
+ */
+class FrameDiffDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param target The display frames are pushed to. Must not be drawn
+   *    onto by anything else, unless invalidate() is called after.
+   * @param width The width of the display in pixels.
+   * @param height The height of the display in pixels.
+   *    width * height must be no more than MAX_FRAME_PIXELS.
+   */
+  FrameDiffDisplay(Display &target, int16_t width, int16_t height);
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  void show();
+
+  /**
+   * @brief Forget what the target is showing, so the next frame is
+   *    pushed in full (e.g. after drawing onto the target directly).
+   */
+  void invalidate();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of frames pushed to the target.
+   */
+  unsigned long getPushCount();
+
+  /**
+   * @brief Get the number of frames not pushed as nothing had changed.
+   */
+  unsigned long getSkippedPushCount();
+
+  /**
+   * @brief Get the number of pixels written through to the target.
+   */
+  unsigned long getPixelsWrittenCount();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The display frames are pushed to.
+   */
+  Display &target;
+
+  /**
+   * @brief The width of the display in pixels.
+   */
+  int16_t width;
+
+  /**
+   * @brief The height of the display in pixels.
+   */
+  int16_t height;
+
+  /**
+   * @brief The frame being drawn, row by row.
+   */
+  uint16_t frame[MAX_FRAME_PIXELS];
+
+  /**
+   * @brief The last frame pushed to the target, row by row.
+   */
+  uint16_t shownFrame[MAX_FRAME_PIXELS];
+
+  /**
+   * @brief Whether or not shownFrame matches what the target is showing.
+   */
+  bool shownFrameValid;
+
+  /**
+   * @brief The number of frames pushed to the target.
+   */
+  unsigned long pushCount;
+
+  /**
+   * @brief The number of frames not pushed.
+   */
+  unsigned long skippedPushCount;
+
+  /**
+   * @brief The number of pixels written through to the target.
+   */
+  unsigned long pixelsWrittenCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGFRAMEDIFFDISPLAY_H
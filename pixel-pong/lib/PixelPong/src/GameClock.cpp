@@ -0,0 +1,87 @@
+#include "GameClock.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param stepMicros The length of a simulation step in microseconds.
+ * @param maxStepsPerAdvance The most steps paid out per advance.
+ */
+GameClock::GameClock(uint32_t stepMicros, int maxStepsPerAdvance)
+    : stepMicros(stepMicros),
+      maxStepsPerAdvance(maxStepsPerAdvance),
+      lastMicros(0),
+      accumulatedMicros(0),
+      droppedStepCount(0) {}
+
+/**
+ * @brief Restart the clock from a point in time, discarding any
+ *    accumulated time (e.g. when unpausing).
+ * 
+ * @param nowMicros The current time in microseconds.
+ */
+void GameClock::reset(uint32_t nowMicros)
+{
+  this->lastMicros = nowMicros;
+  this->accumulatedMicros = 0;
+}
+
+/**
+ * @brief Accumulate the time elapsed since the last advance.
+ * 
+ * @param nowMicros The current time in microseconds.
+ * 
+ * @return The number of simulation steps now due (0 to maxStepsPerAdvance).
+ */
+int GameClock::advance(uint32_t nowMicros)
+{
+  // Unsigned difference copes with the micros counter wrapping
+  this->accumulatedMicros += nowMicros - this->lastMicros;
+  this->lastMicros = nowMicros;
+
+  uint32_t steps = this->accumulatedMicros / this->stepMicros;
+  this->accumulatedMicros -= steps * this->stepMicros;
+  if (steps > (uint32_t)this->maxStepsPerAdvance)
+  {
+    this->droppedStepCount += steps - this->maxStepsPerAdvance;
+    steps = this->maxStepsPerAdvance;
+  }
+  return steps;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the length of a simulation step.
+ * 
+ * @return The step length in microseconds.
+ */
+uint32_t GameClock::getStepMicros()
+{
+  return this->stepMicros;
+}
+
+/**
+ * @brief Get the number of steps dropped because too many were due at once.
+ * 
+ * @return The number of dropped steps since construction.
+ */
+uint32_t GameClock::getDroppedStepCount()
+{
+  return this->droppedStepCount;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
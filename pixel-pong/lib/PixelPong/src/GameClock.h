@@ -0,0 +1,101 @@
+#ifndef PONGGAMECLOCK_H
+#define PONGGAMECLOCK_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Fixed timestep game clock.
+ *    Elapsed time is accumulated each time the clock is advanced and paid
+ *    out in whole simulation steps, so the game runs at the same rate no
+ *    matter how often (or how late) it is woken up.
+ */
+class GameClock
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param stepMicros The length of a simulation step in microseconds.
+   * @param maxStepsPerAdvance The most steps paid out per advance, any
+   *    more are dropped so a long stall can't snowball into a backlog.
+   */
+  GameClock(uint32_t stepMicros, int maxStepsPerAdvance);
+
+  /**
+   * @brief Restart the clock from a point in time, discarding any
+   *    accumulated time (e.g. when unpausing).
+   * 
+   * @param nowMicros The current time in microseconds.
+   */
+  void reset(uint32_t nowMicros);
+
+  /**
+   * @brief Accumulate the time elapsed since the last advance.
+   * 
+   * @param nowMicros The current time in microseconds.
+   * 
+   * @return The number of simulation steps now due (0 to maxStepsPerAdvance).
+   */
+  int advance(uint32_t nowMicros);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the length of a simulation step.
+   * 
+   * @return The step length in microseconds.
+   */
+  uint32_t getStepMicros();
+
+  /**
+   * @brief Get the number of steps dropped because too many were due at once.
+   * 
+   * @return The number of dropped steps since construction.
+   */
+  uint32_t getDroppedStepCount();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The length of a simulation step in microseconds.
+   */
+  uint32_t stepMicros;
+
+  /**
+   * @brief The most steps paid out per advance.
+   */
+  int maxStepsPerAdvance;
+
+  /**
+   * @brief The time of the last advance (or reset) in microseconds.
+   */
+  uint32_t lastMicros;
+
+  /**
+   * @brief Time accumulated but not yet paid out as steps.
+   */
+  uint32_t accumulatedMicros;
+
+  /**
+   * @brief The number of steps dropped.
+   */
+  uint32_t droppedStepCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGGAMECLOCK_H
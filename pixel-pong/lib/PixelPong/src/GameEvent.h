@@ -0,0 +1,38 @@
+#ifndef PONGGAMEEVENT_H
+#define PONGGAMEEVENT_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The types of event passed from interrupts & timers to the game.
+ */
+enum GameEventType
+{
+  PLAY_PAUSE_RESTART_PRESSED,
+  BRIGHTNESS_LOWER_PRESSED,
+  BRIGHTNESS_RAISE_PRESSED,
+  GAME_TICK
+};
+
+/**
+ * @brief A timestamped event, passed through a SpscQueue.
+ *    @see SpscQueue
+ */
+struct GameEvent
+{
+  GameEventType type;       /// What happened.
+  uint32_t timestampMicros; /// When it happened (platform micros), for measuring latency.
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGGAMEEVENT_H
@@ -0,0 +1,163 @@
+#ifndef PONGGAMEGEOMETRY_H
+#define PONGGAMEGEOMETRY_H
+
+#include "Board.h"
+#include "Paddle.h"
+#include "Display.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Dimensions of a board known at compile time.
+ *    Used to build the Board and anything sized by it (e.g. a TransitionTable),
+ *    an impossible board fails to compile.
+ *    e.g. typedef BoardGeometry<8, 8> GameBoard;
+ * 
+ * @tparam XDim The X-dimension of the board in pixels.
+ * @tparam YDim The Y-dimension of the board in pixels.
+ */
+template <int XDim, int YDim>
+struct BoardGeometry
+{
+  static_assert(XDim >= 3, "The board needs a column for each paddle and one between them");
+  static_assert(YDim >= 1, "The board needs at least one row");
+  static_assert(XDim * YDim <= MAX_FRAME_PIXELS, "The board must fit in a frame (MAX_FRAME_PIXELS)");
+
+  static constexpr int xDim = XDim;
+  static constexpr int yDim = YDim;
+};
+
+/**
+ * @brief Size, anchor and hit regions of a paddle known at compile time.
+ *    Extents & region boundaries are offsets in rows from the anchor
+ *    (positive is up), so collision maths using them folds to constants.
+ *    The hit regions are given as sizes in the same order as HitRegions,
+ *    so GAME_PADDLE_HIT_REGIONS can be passed.
+ *    e.g. typedef PaddleGeometry<3, 1, 1, 1, 1> GamePaddle;
+ * 
+ * @tparam Size The size of the paddle in pixels.
+ * @tparam Anchor The pixel used to position the paddle @see Paddle::Paddle
+ * @tparam TopSize The size of the top region.
+ * @tparam MiddleSize The size of the middle region.
+ * @tparam BottomSize The size of the bottom region.
+ */
+template <int Size, int Anchor, int TopSize, int MiddleSize, int BottomSize>
+struct PaddleGeometry
+{
+  static_assert(Size >= 1, "The paddle needs at least one pixel");
+  static_assert(Anchor >= 0 && Anchor < Size, "The anchor must be one of the paddle's pixels");
+  static_assert(TopSize >= 0 && MiddleSize >= 0 && BottomSize >= 0, "Hit regions can't have a negative size");
+  static_assert(TopSize + MiddleSize + BottomSize == Size, "The hit regions must cover the paddle");
+
+  static constexpr int size = Size;
+  static constexpr int anchor = Anchor;
+
+  /**
+   * @brief Rows above & below the anchor covered by the paddle.
+   */
+  static constexpr int extentAbove = Size - 1 - Anchor;
+  static constexpr int extentBelow = Anchor;
+
+  /**
+   * @brief The lowest row (offset from the anchor) of the top & middle regions,
+   *    anything below the middle region is the bottom region.
+   */
+  static constexpr int topRegionMin = extentAbove - TopSize + 1;
+  static constexpr int middleRegionMin = extentAbove - (TopSize + MiddleSize) + 1;
+
+  /**
+   * @brief Get the hit regions for a Paddle.
+   */
+  static constexpr HitRegions regions()
+  {
+    return HitRegions{TopSize, MiddleSize, BottomSize};
+  }
+
+  /**
+   * @brief Get the region of the paddle a row belongs to.
+   *    Matches Paddle::checkPaddleCollision.
+   * 
+   * @param offset The row as an offset from the anchor (positive is up).
+   * 
+   * @return The region, NO_COLLISION if the row is off the paddle.
+   */
+  static constexpr CollisionRegion regionAt(int offset)
+  {
+    return offset > extentAbove || offset < -extentBelow
+               ? NO_COLLISION
+               : (offset >= topRegionMin ? TOP : (offset >= middleRegionMin ? MIDDLE : BOTTOM));
+  }
+
+  /**
+   * @brief Check whether or not an entity in a given position would collide
+   *    with a paddle in a given position, and the region hit.
+   *    Matches Paddle::checkPaddleCollision.
+   * 
+   * @param paddle The position of the paddle (anchor).
+   * @param position The position of the entity.
+   * 
+   * @return The region hit, NO_COLLISION if none.
+   */
+  static constexpr CollisionRegion checkCollision(Position paddle, Position position)
+  {
+    return position.x != paddle.x ? NO_COLLISION : regionAt(position.y - paddle.y);
+  }
+};
+
+/**
+ * @brief A board and the paddles played on it, checked against each other
+ *    at compile time, with the paddles' valid positions built as constant
+ *    data (no work at startup and, declared constexpr, stored in flash).
+ *    e.g. typedef GameGeometry<GameBoard, GamePaddle> Game;
+ *         constexpr PaddlePositions validPaddlePositions = Game::validPaddlePositions();
+ * 
+ * @tparam BoardG A BoardGeometry.
+ * @tparam PaddleG A PaddleGeometry (both paddles are the same).
+ */
+template <class BoardG, class PaddleG>
+struct GameGeometry
+{
+  typedef BoardG BoardType;
+  typedef PaddleG PaddleType;
+
+  static_assert(PaddleG::size <= BoardG::yDim, "The paddles must fit on the board");
+  static_assert(BoardG::yDim - PaddleG::size + 1 <= MAX_PADDLE_POSITIONS, "Too many paddle positions (MAX_PADDLE_POSITIONS)");
+
+  /**
+   * @brief The number of valid positions of a paddle, and the lowest & highest.
+   */
+  static constexpr int paddlePositionCount = BoardG::yDim - PaddleG::size + 1;
+  static constexpr int paddleYMin = PaddleG::extentBelow;
+  static constexpr int paddleYMax = BoardG::yDim - 1 - PaddleG::extentAbove;
+
+  /**
+   * @brief Get the valid Y coordinates of the paddles.
+   */
+  static constexpr PaddlePositions validPaddlePositions()
+  {
+    return makePaddlePositions(BoardG::yDim, PaddleG::size, PaddleG::anchor);
+  }
+
+  /**
+   * @brief Check whether or not a paddle position is on the board,
+   *    paddle 1 being in the left column and paddle 2 in the right.
+   * 
+   * @param x The X-coordinate of the paddle.
+   * @param y The Y-coordinate of the paddle (anchor).
+   */
+  static constexpr bool isValidPaddlePosition(int x, int y)
+  {
+    return (x == 0 || x == BoardG::xDim - 1) && y >= paddleYMin && y <= paddleYMax;
+  }
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGGAMEGEOMETRY_H
@@ -2,9 +2,9 @@
 #define PONGHELPERS_H
 
 #include <stdlib.h>
-#include <Arduino.h>
-#include <random>
-#include <vector>
+#include <stdint.h>
+#include "FixedPoint.h"
+#include "Random.h"
 
 /**
  * @brief Structure for representing the position of an entity.
@@ -14,30 +14,104 @@ struct Position
   int x; /// The X position of the entity.
   int y; /// The Y position of the entity.
 
-  Position(int x_, int y_)
+  constexpr Position(int x_, int y_) : x(x_), y(y_) {}
+};
+
+/**
+ * @brief Structure for representing the sub-pixel position of an entity.
+ *    Coordinates are in fixed point pixels, where a whole number is the
+ *    centre of that pixel, i.e. (2.0, 3.0) is the centre of pixel (2, 3)
+ *    and anything within half a pixel of it is drawn on that pixel.
+ */
+struct PrecisePosition
+{
+  fixed_t x; /// The X position of the entity.
+  fixed_t y; /// The Y position of the entity.
+
+  PrecisePosition(fixed_t x_, fixed_t y_)
   {
     x = x_;
     y = y_;
   }
+
+  /**
+   * @brief Get the precise position of the centre of a pixel.
+   */
+  static PrecisePosition fromPosition(Position position)
+  {
+    return PrecisePosition(intToFixed(position.x), intToFixed(position.y));
+  }
+
+  /**
+   * @brief Get the pixel this position is drawn on.
+   */
+  Position toPosition() const
+  {
+    return Position(fixedRound(x), fixedRound(y));
+  }
 };
 
-// TODO - look at adding magnitude to this to speed up the ball.
 /**
  * @brief Structure for repesenting the velocity of an entity.
+ *    Components are fixed point pixels per 'timestep' of the game,
+ *    so any speed and angle can be represented.
  */
 struct Velocity
 {
-  int x; /// The X component direction
-  int y; /// The Y component direction
+  fixed_t x; /// The X component in pixels per timestep.
+  fixed_t y; /// The Y component in pixels per timestep.
 
+  /**
+   * @brief Construct a velocity from whole pixels per timestep,
+   *    e.g. Velocity(-1, 1) moves one pixel left and one up each timestep.
+   */
   Velocity(int x_, int y_)
   {
-    x = x_;
-    y = y_;
+    x = intToFixed(x_);
+    y = intToFixed(y_);
+  }
+
+  /**
+   * @brief Construct a velocity from fixed point components.
+   */
+  static Velocity fromFixed(fixed_t x_, fixed_t y_)
+  {
+    Velocity velocity(0, 0);
+    velocity.x = x_;
+    velocity.y = y_;
+    return velocity;
   }
-};
 
-int getNotSoRandomElement(std::vector<int> options);
+  /**
+   * @brief Get the speed, the distance covered along the major axis
+   *    per timestep (so diagonal and straight movement at the same
+   *    speed cross pixels at the same rate, as on the pixel grid).
+   */
+  fixed_t getSpeed() const
+  {
+    fixed_t absX = fixedAbs(x);
+    fixed_t absY = fixedAbs(y);
+    return absX > absY ? absX : absY;
+  }
+
+  /**
+   * @brief Get a velocity in the same direction with a different speed.
+   *    A stationary velocity stays stationary.
+   * 
+   * @param speed The new speed @see Velocity::getSpeed
+   */
+  Velocity withSpeed(fixed_t speed) const
+  {
+    fixed_t currentSpeed = getSpeed();
+    if (currentSpeed == 0)
+    {
+      return *this;
+    }
+    return fromFixed(
+        (fixed_t)(((int64_t)x * speed) / currentSpeed),
+        (fixed_t)(((int64_t)y * speed) / currentSpeed));
+  }
+};
 
 /**
  * @brief An enum for defined surface orientation
@@ -57,13 +131,13 @@ enum CollisionSurfaceOrientation
  * @param velocity The velocity of the entity.
  * @param surfaceOrientation Whether the collision surface is 
  *    oriented verticall or horizontally to the entity.
- * @param random Whether or not the randomly select one of the 
+ * @param random The generator used to randomly select one of the
  *    velocity components (not entirely random as this was 
  *    designed for Pong so it ensures the ball will stay 
- *    reachable by the paddles)
+ *    reachable by the paddles), NULL for a plain rebound.
  * 
  * @return Velocity The new velocity after rebounding.
  */
-Velocity reboundVelocity(Velocity velocity, CollisionSurfaceOrientation surfaceOrientation, bool random = false);
+Velocity reboundVelocity(Velocity velocity, CollisionSurfaceOrientation surfaceOrientation, Random *random = NULL);
 
 #endif //PONGHELPERS_H
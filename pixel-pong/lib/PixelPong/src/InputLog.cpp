@@ -0,0 +1,310 @@
+#include "InputLog.h"
+#include <string.h>
+
+/**
+ * @brief Write & read multi-byte values little endian, whatever the platform.
+ */
+static void writeUint32(uint8_t *to, uint32_t value)
+{
+  to[0] = value & 0xFF;
+  to[1] = (value >> 8) & 0xFF;
+  to[2] = (value >> 16) & 0xFF;
+  to[3] = (value >> 24) & 0xFF;
+}
+
+static uint32_t readUint32(const uint8_t *from)
+{
+  return (uint32_t)from[0] | ((uint32_t)from[1] << 8) | ((uint32_t)from[2] << 16) | ((uint32_t)from[3] << 24);
+}
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param buffer Where the log is written.
+ * @param capacity The size of the buffer in bytes.
+ */
+InputLog::InputLog(uint8_t *buffer, size_t capacity)
+    : buffer(buffer), capacity(capacity), size(0), stepCount(0), truncated(false) {}
+
+/**
+ * @brief Start a new log, discarding anything recorded so far.
+ * 
+ * @param header The configuration of the game being recorded.
+ */
+void InputLog::begin(const InputLogHeader &header)
+{
+  size = 0;
+  stepCount = 0;
+  truncated = false;
+  uint8_t *to = reserve(INPUT_LOG_HEADER_SIZE);
+  if (to == NULL)
+  {
+    return;
+  }
+  memcpy(to, INPUT_LOG_MAGIC, 4);
+  to[4] = INPUT_LOG_VERSION;
+  to[5] = header.boardX;
+  to[6] = header.boardY;
+  to[7] = header.paddleSize;
+  to[8] = header.paddleAnchor;
+  to[9] = header.topSize;
+  to[10] = header.middleSize;
+  to[11] = header.bottomSize;
+  writeUint32(to + 12, header.seed);
+}
+
+/**
+ * @brief Record a call to PixelPong::handle().
+ * 
+ * @param paddle1Y Paddle 1's Y-coordinate for the step.
+ * @param paddle2Y Paddle 2's Y-coordinate for the step.
+ * @param stateHash The state hash after the step @see PixelPong::getStateHash
+ * 
+ * @return Whether or not it was recorded.
+ */
+bool InputLog::recordStep(int paddle1Y, int paddle2Y, uint32_t stateHash)
+{
+  uint8_t *to = reserve(INPUT_LOG_STEP_SIZE);
+  if (to == NULL)
+  {
+    return false;
+  }
+  // 2 bit type, 7 bits per paddle & 8 bits of hash
+  to[0] = (INPUT_LOG_STEP << 6) | ((paddle1Y & 0x7F) >> 1);
+  to[1] = ((paddle1Y & 0x1) << 7) | (paddle2Y & 0x7F);
+  to[2] = stateHash & 0xFF;
+  stepCount++;
+  return true;
+}
+
+/**
+ * @brief Record an event.
+ * 
+ * @param event The GameEventType or INPUT_LOG_RESET.
+ * 
+ * @return Whether or not it was recorded.
+ */
+bool InputLog::recordEvent(int event)
+{
+  uint8_t *to = reserve(INPUT_LOG_EVENT_SIZE);
+  if (to == NULL)
+  {
+    return false;
+  }
+  to[0] = (INPUT_LOG_EVENT << 6) | (event & 0x3F);
+  return true;
+}
+
+/**
+ * @brief Record a change to the ball's speed.
+ * 
+ * @param speed The new speed.
+ * 
+ * @return Whether or not it was recorded.
+ */
+bool InputLog::recordSpeed(fixed_t speed)
+{
+  uint8_t *to = reserve(INPUT_LOG_SPEED_SIZE);
+  if (to == NULL)
+  {
+    return false;
+  }
+  to[0] = INPUT_LOG_SPEED << 6;
+  writeUint32(to + 1, (uint32_t)speed);
+  return true;
+}
+
+/**
+ * @brief Record the full state hash after a step.
+ * 
+ * @param stateHash The state hash @see PixelPong::getStateHash
+ * 
+ * @return Whether or not it was recorded.
+ */
+bool InputLog::recordCheckpoint(uint32_t stateHash)
+{
+  uint8_t *to = reserve(INPUT_LOG_CHECKPOINT_SIZE);
+  if (to == NULL)
+  {
+    return false;
+  }
+  to[0] = INPUT_LOG_CHECKPOINT << 6;
+  writeUint32(to + 1, stateHash);
+  return true;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the log.
+ */
+const uint8_t *InputLog::getData()
+{
+  return buffer;
+}
+
+/**
+ * @brief Get the size of the log in bytes.
+ */
+size_t InputLog::getSize()
+{
+  return size;
+}
+
+/**
+ * @brief Get the number of steps recorded.
+ */
+uint32_t InputLog::getStepCount()
+{
+  return stepCount;
+}
+
+/**
+ * @brief Check whether records have been dropped because the buffer was full.
+ */
+bool InputLog::isTruncated()
+{
+  return truncated;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+/**
+ * @brief Reserve room for a record.
+ *    Once one record is dropped so is everything after it, a log with a
+ *    gap in it couldn't be replayed.
+ * 
+ * @param recordSize The size of the record in bytes.
+ * 
+ * @return Where to write the record, NULL if it doesn't fit.
+ */
+uint8_t *InputLog::reserve(size_t recordSize)
+{
+  if (truncated || size + recordSize > capacity)
+  {
+    truncated = true;
+    return NULL;
+  }
+  uint8_t *to = buffer + size;
+  size += recordSize;
+  return to;
+}
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param data The log.
+ * @param size The size of the log in bytes.
+ */
+InputLogReader::InputLogReader(const uint8_t *data, size_t size)
+    : data(data), size(size), offset(0) {}
+
+/**
+ * @brief Read the header, must be called before the records are read.
+ * 
+ * @param header Set to the header.
+ * 
+ * @return Whether or not the log has a valid header.
+ */
+bool InputLogReader::readHeader(InputLogHeader &header)
+{
+  if (size < INPUT_LOG_HEADER_SIZE || memcmp(data, INPUT_LOG_MAGIC, 4) != 0 || data[4] != INPUT_LOG_VERSION)
+  {
+    return false;
+  }
+  header.boardX = data[5];
+  header.boardY = data[6];
+  header.paddleSize = data[7];
+  header.paddleAnchor = data[8];
+  header.topSize = data[9];
+  header.middleSize = data[10];
+  header.bottomSize = data[11];
+  header.seed = readUint32(data + 12);
+  offset = INPUT_LOG_HEADER_SIZE;
+  return true;
+}
+
+/**
+ * @brief Read the next record.
+ * 
+ * @param record Set to the record.
+ * 
+ * @return Whether or not there was a complete record.
+ */
+bool InputLogReader::next(InputLogRecord &record)
+{
+  if (offset >= size)
+  {
+    return false;
+  }
+  const uint8_t *from = data + offset;
+  record.type = (InputLogRecordType)(from[0] >> 6);
+  size_t recordSize = INPUT_LOG_EVENT_SIZE;
+  switch (record.type)
+  {
+  case INPUT_LOG_STEP:
+    recordSize = INPUT_LOG_STEP_SIZE;
+    break;
+
+  case INPUT_LOG_EVENT:
+    recordSize = INPUT_LOG_EVENT_SIZE;
+    break;
+
+  case INPUT_LOG_SPEED:
+    recordSize = INPUT_LOG_SPEED_SIZE;
+    break;
+
+  case INPUT_LOG_CHECKPOINT:
+    recordSize = INPUT_LOG_CHECKPOINT_SIZE;
+    break;
+  }
+  if (offset + recordSize > size)
+  {
+    return false;
+  }
+  offset += recordSize;
+
+  switch (record.type)
+  {
+  case INPUT_LOG_STEP:
+    record.paddle1Y = ((from[0] & 0x3F) << 1) | (from[1] >> 7);
+    record.paddle2Y = from[1] & 0x7F;
+    record.stateHash = from[2];
+    break;
+
+  case INPUT_LOG_EVENT:
+    record.event = from[0] & 0x3F;
+    break;
+
+  case INPUT_LOG_SPEED:
+    record.speed = (fixed_t)readUint32(from + 1);
+    break;
+
+  case INPUT_LOG_CHECKPOINT:
+    record.stateHash = readUint32(from + 1);
+    break;
+  }
+  return true;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,270 @@
+#ifndef PONGINPUTLOG_H
+#define PONGINPUTLOG_H
+
+#include "FixedPoint.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Layout of a log.
+ *    A 16 byte header (INPUT_LOG_MAGIC, version, board & paddle
+ *    configuration and the seed of the game's Random) followed by records,
+ *    each starting with a byte whose top 2 bits are the record type.
+ */
+#define INPUT_LOG_MAGIC "PPIL"
+#define INPUT_LOG_VERSION 1
+#define INPUT_LOG_HEADER_SIZE 16
+#define INPUT_LOG_STEP_SIZE 3       // Type, paddle 1 Y (7 bits), paddle 2 Y (7 bits), state hash (8 bits)
+#define INPUT_LOG_EVENT_SIZE 1      // Type, event code (6 bits)
+#define INPUT_LOG_SPEED_SIZE 5      // Type, speed (fixed_t)
+#define INPUT_LOG_CHECKPOINT_SIZE 5 // Type, state hash (32 bits)
+#define INPUT_LOG_MAX_Y 127         // Highest paddle Y-coordinate a step can hold (7 bits)
+
+/**
+ * @brief Steps between full (32-bit) state hashes, each step carries 8 bits.
+ */
+#define INPUT_LOG_CHECKPOINT_STEPS 256
+
+/**
+ * @brief Event code recorded when the game is reset to its starting state.
+ *    Other event codes are GameEventType values.
+ */
+#define INPUT_LOG_RESET 0x3F
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The configuration a log was recorded with, enough to set up
+ *    an identical game to replay it in.
+ */
+struct InputLogHeader
+{
+  int boardX;          /// Size of the board X dimension in pixels.
+  int boardY;          /// Size of the board Y dimension in pixels.
+  int paddleSize;      /// Size of the paddles in pixels.
+  int paddleAnchor;    /// The paddle anchor @see Paddle::Paddle
+  int topSize;         /// The paddles' HitRegions.
+  int middleSize;
+  int bottomSize;
+  uint32_t seed;       /// The state of the game's Random when recording started.
+};
+
+/**
+ * @brief The types of record in a log.
+ */
+enum InputLogRecordType
+{
+  INPUT_LOG_STEP,      /// A call to PixelPong::handle().
+  INPUT_LOG_EVENT,     /// A button press, or INPUT_LOG_RESET.
+  INPUT_LOG_SPEED,     /// The ball's speed was changed.
+  INPUT_LOG_CHECKPOINT /// The full state hash after a step.
+};
+
+/**
+ * @brief A record read back from a log.
+ */
+struct InputLogRecord
+{
+  InputLogRecordType type;
+  int paddle1Y;       /// STEP: Paddle 1's Y-coordinate for the step.
+  int paddle2Y;       /// STEP: Paddle 2's Y-coordinate for the step.
+  uint32_t stateHash; /// STEP: Low 8 bits of the state hash after the step, CHECKPOINT: the full hash.
+  int event;          /// EVENT: The GameEventType or INPUT_LOG_RESET.
+  fixed_t speed;      /// SPEED: The new speed of the ball.
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Compact binary log of everything that feeds into a game: the
+ *    seed, the paddles' positions for each step, button events and ball
+ *    speed changes, along with a hash of the game state after each step.
+ *    Replaying the inputs through PixelPong::handle() must give the same
+ *    hashes, so a recorded match can be re-run (and checked) off-device.
+ *    Written into a caller supplied buffer, once full further records
+ *    are dropped and the log is marked truncated.
+ */
+class InputLog
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param buffer Where the log is written.
+   * @param capacity The size of the buffer in bytes.
+   */
+  InputLog(uint8_t *buffer, size_t capacity);
+
+  /**
+   * @brief Start a new log, discarding anything recorded so far.
+   * 
+   * @param header The configuration of the game being recorded.
+   */
+  void begin(const InputLogHeader &header);
+
+  /**
+   * @brief Record a call to PixelPong::handle().
+   * 
+   * @param paddle1Y Paddle 1's Y-coordinate for the step.
+   * @param paddle2Y Paddle 2's Y-coordinate for the step.
+   * @param stateHash The state hash after the step @see PixelPong::getStateHash
+   * 
+   * @return Whether or not it was recorded.
+   */
+  bool recordStep(int paddle1Y, int paddle2Y, uint32_t stateHash);
+
+  /**
+   * @brief Record an event.
+   * 
+   * @param event The GameEventType or INPUT_LOG_RESET.
+   * 
+   * @return Whether or not it was recorded.
+   */
+  bool recordEvent(int event);
+
+  /**
+   * @brief Record a change to the ball's speed.
+   * 
+   * @param speed The new speed.
+   * 
+   * @return Whether or not it was recorded.
+   */
+  bool recordSpeed(fixed_t speed);
+
+  /**
+   * @brief Record the full state hash after a step.
+   * 
+   * @param stateHash The state hash @see PixelPong::getStateHash
+   * 
+   * @return Whether or not it was recorded.
+   */
+  bool recordCheckpoint(uint32_t stateHash);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the log.
+   */
+  const uint8_t *getData();
+
+  /**
+   * @brief Get the size of the log in bytes.
+   */
+  size_t getSize();
+
+  /**
+   * @brief Get the number of steps recorded.
+   */
+  uint32_t getStepCount();
+
+  /**
+   * @brief Check whether records have been dropped because the buffer was full.
+   */
+  bool isTruncated();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief Where the log is written, and its size.
+   */
+  uint8_t *buffer;
+  size_t capacity;
+
+  /**
+   * @brief The size of the log so far.
+   */
+  size_t size;
+
+  /**
+   * @brief The number of steps recorded.
+   */
+  uint32_t stepCount;
+
+  /**
+   * @brief Set once a record has been dropped.
+   */
+  bool truncated;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Reserve room for a record.
+   * 
+   * @param recordSize The size of the record in bytes.
+   * 
+   * @return Where to write the record, NULL if it doesn't fit.
+   */
+  uint8_t *reserve(size_t recordSize);
+};
+
+/**
+ * @brief Reads the header & records back out of a log.
+ */
+class InputLogReader
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param data The log.
+   * @param size The size of the log in bytes.
+   */
+  InputLogReader(const uint8_t *data, size_t size);
+
+  /**
+   * @brief Read the header, must be called before the records are read.
+   * 
+   * @param header Set to the header.
+   * 
+   * @return Whether or not the log has a valid header.
+   */
+  bool readHeader(InputLogHeader &header);
+
+  /**
+   * @brief Read the next record.
+   * 
+   * @param record Set to the record.
+   * 
+   * @return Whether or not there was a complete record.
+   */
+  bool next(InputLogRecord &record);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The log, its size and how much has been read.
+   */
+  const uint8_t *data;
+  size_t size;
+  size_t offset;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGINPUTLOG_H
@@ -0,0 +1,171 @@
+#include "LatencyHistogram.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ */
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+/**
+ * @brief Record a latency.
+ * 
+ * @param cycles The latency in cycles @see platformCycleCount
+ */
+void LatencyHistogram::record(uint32_t cycles)
+{
+  buckets[bucketFor(cycles)]++;
+  count++;
+  max = cycles > max ? cycles : max;
+}
+
+/**
+ * @brief Discard everything recorded.
+ */
+void LatencyHistogram::reset()
+{
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  max = 0;
+}
+
+/**
+ * @brief Get a percentile of the latencies recorded.
+ * 
+ * @param permille The percentile in tenths of a percent, e.g. 990 for p99.
+ * 
+ * @return The upper bound of the bucket the percentile falls in
+ *    (no more than the max), 0 if nothing has been recorded.
+ */
+uint32_t LatencyHistogram::percentile(int permille)
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+  // The rank of the latency wanted, rounded up so p100 is the last
+  uint32_t rank = (uint32_t)(((uint64_t)count * permille + 999) / 1000);
+  rank = rank < 1 ? 1 : rank;
+  uint32_t seen = 0;
+  for (int i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++)
+  {
+    seen += buckets[i];
+    if (seen >= rank)
+    {
+      uint32_t upperBound = bucketUpperBound(i);
+      return upperBound < max ? upperBound : max;
+    }
+  }
+  return max;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of latencies recorded.
+ */
+uint32_t LatencyHistogram::getCount()
+{
+  return count;
+}
+
+/**
+ * @brief Get the longest latency recorded.
+ */
+uint32_t LatencyHistogram::getMax()
+{
+  return max;
+}
+
+/**
+ * @brief Get the bucket a latency is recorded in.
+ *    Small latencies get a bucket each, after that the bucket is picked
+ *    by the highest set bit and the LATENCY_SUB_BUCKET_BITS below it.
+ * 
+ * @param cycles The latency.
+ */
+int LatencyHistogram::bucketFor(uint32_t cycles)
+{
+  if (cycles < LATENCY_SUB_BUCKETS)
+  {
+    return cycles;
+  }
+  int highestBit = 31 - __builtin_clz(cycles);
+  int shift = highestBit - LATENCY_SUB_BUCKET_BITS;
+  return ((highestBit - LATENCY_SUB_BUCKET_BITS + 1) << LATENCY_SUB_BUCKET_BITS) + ((cycles >> shift) & (LATENCY_SUB_BUCKETS - 1));
+}
+
+/**
+ * @brief Get the largest latency recorded in a bucket.
+ * 
+ * @param bucket The bucket.
+ */
+uint32_t LatencyHistogram::bucketUpperBound(int bucket)
+{
+  if (bucket < LATENCY_SUB_BUCKETS)
+  {
+    return bucket;
+  }
+  int shift = (bucket >> LATENCY_SUB_BUCKET_BITS) - 1;
+  uint32_t lowerBound = (uint32_t)(LATENCY_SUB_BUCKETS + (bucket & (LATENCY_SUB_BUCKETS - 1))) << shift;
+  return lowerBound + ((1u << shift) - 1);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+const char *LATENCY_CSV_HEADER = "stage,count,p50_cycles,p99_cycles,max_cycles,p50_us,p99_us,max_us";
+
+/**
+ * @brief Format a histogram's summary as a CSV row
+ *    (stage,count,p50_cycles,p99_cycles,max_cycles,p50_us,p99_us,max_us).
+ * 
+ * @param name Name of the stage timed.
+ * @param histogram The histogram.
+ * @param cyclesPerMicro Cycles per microsecond, the _us columns are left empty if 0.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatLatencyHistogram(const char *name, LatencyHistogram &histogram, uint32_t cyclesPerMicro, char *buffer, int size)
+{
+  uint32_t p50 = histogram.percentile(500);
+  uint32_t p99 = histogram.percentile(990);
+  uint32_t max = histogram.getMax();
+  if (cyclesPerMicro == 0)
+  {
+    snprintf(buffer, size, "%s,%lu,%lu,%lu,%lu,,,", name, (unsigned long)histogram.getCount(),
+             (unsigned long)p50, (unsigned long)p99, (unsigned long)max);
+    return;
+  }
+  snprintf(buffer, size, "%s,%lu,%lu,%lu,%lu,%.1f,%.1f,%.1f", name, (unsigned long)histogram.getCount(),
+           (unsigned long)p50, (unsigned long)p99, (unsigned long)max,
+           (double)p50 / cyclesPerMicro, (double)p99 / cyclesPerMicro, (double)max / cyclesPerMicro);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,179 @@
+#ifndef PONGLATENCYHISTOGRAM_H
+#define PONGLATENCYHISTOGRAM_H
+
+#include "Platform.h"
+#include <stdint.h>
+
+/**
+ * @brief Each power of two is split into 2^LATENCY_SUB_BUCKET_BITS buckets,
+ *    so a percentile is within ~19% (one bucket) of the true value.
+ */
+#define LATENCY_SUB_BUCKET_BITS 2
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BUCKET_BITS)
+
+/**
+ * @brief Enough buckets for every 32 bit value.
+ */
+#define LATENCY_HISTOGRAM_BUCKETS ((32 - LATENCY_SUB_BUCKET_BITS + 1) * LATENCY_SUB_BUCKETS)
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Fixed size histogram of latencies (cycle counts or microseconds) in
+ *    log spaced buckets, recording is a handful of instructions and never allocates.
+ *    Reports the percentiles & max of everything recorded since the last reset.
+ *    Recorded into by a single task, anything reading it from another should
+ *    hold whatever lock that task holds while recording.
+ */
+class LatencyHistogram
+{
+public:
+  /**
+   * @brief Class constructor.
+   */
+  LatencyHistogram();
+
+  /**
+   * @brief Record a latency.
+   * 
+   * @param cycles The latency in cycles @see platformCycleCount
+   */
+  void record(uint32_t cycles);
+
+  /**
+   * @brief Discard everything recorded.
+   */
+  void reset();
+
+  /**
+   * @brief Get a percentile of the latencies recorded.
+   * 
+   * @param permille The percentile in tenths of a percent, e.g. 990 for p99.
+   * 
+   * @return The upper bound of the bucket the percentile falls in
+   *    (no more than the max), 0 if nothing has been recorded.
+   */
+  uint32_t percentile(int permille);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of latencies recorded.
+   */
+  uint32_t getCount();
+
+  /**
+   * @brief Get the longest latency recorded.
+   */
+  uint32_t getMax();
+
+  /**
+   * @brief Get the bucket a latency is recorded in.
+   * 
+   * @param cycles The latency.
+   */
+  static int bucketFor(uint32_t cycles);
+
+  /**
+   * @brief Get the largest latency recorded in a bucket.
+   * 
+   * @param bucket The bucket.
+   */
+  static uint32_t bucketUpperBound(int bucket);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The number of latencies recorded in each bucket.
+   */
+  uint32_t buckets[LATENCY_HISTOGRAM_BUCKETS];
+
+  /**
+   * @brief The number of latencies recorded, and the longest.
+   */
+  uint32_t count;
+  uint32_t max;
+};
+
+/**
+ * @brief Times the scope it is declared in, recording the cycles taken
+ *    into a histogram when it ends.
+ *    e.g. { LatencyTimer timer(handleLatency); pong.handle(); }
+ */
+class LatencyTimer
+{
+public:
+  /**
+   * @brief Class constructor, starts timing.
+   * 
+   * @param histogram Where the latency is recorded.
+   */
+  LatencyTimer(LatencyHistogram &histogram) : histogram(histogram), startCycles(platformCycleCount()) {}
+
+  /**
+   * @brief Class destructor, stops timing & records the latency.
+   */
+  ~LatencyTimer()
+  {
+    histogram.record(platformCycleCount() - startCycles);
+  }
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief Where the latency is recorded.
+   */
+  LatencyHistogram &histogram;
+
+  /**
+   * @brief The cycle count when timing started.
+   */
+  uint32_t startCycles;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Format a histogram's summary as a CSV row
+ *    (stage,count,p50_cycles,p99_cycles,max_cycles,p50_us,p99_us,max_us).
+ * 
+ * @param name Name of the stage timed.
+ * @param histogram The histogram.
+ * @param cyclesPerMicro Cycles per microsecond, the _us columns are left empty if 0.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatLatencyHistogram(const char *name, LatencyHistogram &histogram, uint32_t cyclesPerMicro, char *buffer, int size);
+
+/**
+ * @brief The CSV header matching formatLatencyHistogram.
+ */
+extern const char *LATENCY_CSV_HEADER;
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGLATENCYHISTOGRAM_H
@@ -0,0 +1,45 @@
+#ifndef PONGLEDCHANNEL_H
+#define PONGLEDCHANNEL_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Interface for an output channel driving one LED strip (or panel).
+ *    Channels are independent, so a display made of several panels
+ *    can have them all refreshed at the same time.
+ *    @see TiledDisplay
+ */
+class LedChannel
+{
+public:
+  virtual ~LedChannel() {}
+
+  /**
+   * @brief Set up the channel's hardware.
+   * 
+   * @return Whether or not the channel could be set up.
+   */
+  virtual bool begin() = 0;
+
+  /**
+   * @brief Start sending a frame. May return before the frame has been
+   *    sent, so the other channels can be started.
+   * 
+   * @param pixels The colour bytes of the frame, in strip order.
+   * @param numPixels The number of pixels in the frame.
+   */
+  virtual void show(const uint8_t *pixels, uint16_t numPixels) = 0;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGLEDCHANNEL_H
@@ -0,0 +1,150 @@
+#include "Log.h"
+#include "Platform.h"
+#include <atomic>
+#include <stdio.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  LOG                                                       
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+static_assert(LOG_BUFFER_SIZE > 0 && (LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) == 0, "LOG_BUFFER_SIZE must be a power of two");
+
+/**
+ * @brief A slot in the ring buffer. The sequence number says whose turn
+ *    it is: equal to the write position when free to write, one past it
+ *    once written and ready to read. It is stored less the slot's index,
+ *    so the zero initialised buffer starts out free with nothing to set up.
+ */
+struct LogSlot
+{
+  std::atomic<uint32_t> sequence;
+  LogRecord record;
+};
+
+/**
+ * @brief The ring buffer, any number of writers and a single reader.
+ */
+static LogSlot slots[LOG_BUFFER_SIZE];
+
+/**
+ * @brief Position of the next record to be written, claimed by writers.
+ */
+static std::atomic<uint32_t> writePosition(0);
+
+/**
+ * @brief Position of the next record to be read, only used by the reader.
+ */
+static uint32_t readPosition = 0;
+
+/**
+ * @brief The number of records dropped.
+ */
+static std::atomic<uint32_t> droppedCount(0);
+
+/**
+ * @brief Claim a slot and fill it in.
+ * 
+ * @param record The record to write.
+ * 
+ * @return Whether or not there was room for the record.
+ */
+static bool writeRecord(const LogRecord &record)
+{
+  uint32_t position = writePosition.load(std::memory_order_relaxed);
+  LogSlot *slot;
+  for (;;)
+  {
+    uint32_t index = position & (LOG_BUFFER_SIZE - 1);
+    slot = &slots[index];
+    int32_t turn = (int32_t)(slot->sequence.load(std::memory_order_acquire) + index - position);
+    if (turn == 0)
+    {
+      // Free, try to claim it (position is refreshed if another writer got there first)
+      if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (turn < 0)
+    {
+      // Still holds a record from the last time round, full
+      droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+    {
+      position = writePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->record = record;
+  slot->sequence.store(position + 1 - (position & (LOG_BUFFER_SIZE - 1)), std::memory_order_release);
+  return true;
+}
+
+bool logWrite(uint8_t level, const char *message)
+{
+  LogRecord record = {(uint32_t)platformMicros(), message, 0, level, false};
+  return writeRecord(record);
+}
+
+bool logWrite(uint8_t level, const char *message, int32_t value)
+{
+  LogRecord record = {(uint32_t)platformMicros(), message, value, level, true};
+  return writeRecord(record);
+}
+
+bool logRead(LogRecord &record)
+{
+  uint32_t index = readPosition & (LOG_BUFFER_SIZE - 1);
+  LogSlot &slot = slots[index];
+  if (slot.sequence.load(std::memory_order_acquire) + index != readPosition + 1)
+  {
+    return false;
+  }
+  record = slot.record;
+  // Hand the slot back to the writers for the next time round
+  slot.sequence.store(readPosition + LOG_BUFFER_SIZE - index, std::memory_order_release);
+  readPosition++;
+  return true;
+}
+
+int logDrain(int maxRecords)
+{
+  static const char *levelNames[] = {"", "ERROR", "WARN", "INFO", "DEBUG"};
+  int drained = 0;
+  LogRecord record;
+  while (drained < maxRecords && logRead(record))
+  {
+    drained++;
+    if (!platformIsLogEnabled())
+    {
+      continue;
+    }
+
+    char line[96];
+    const char *levelName = record.level <= LOG_LEVEL_DEBUG ? levelNames[record.level] : "";
+    if (record.hasValue)
+    {
+      snprintf(line, sizeof(line), "%lu %s %s %ld", (unsigned long)record.timestampMicros, levelName, record.message, (long)record.value);
+    }
+    else
+    {
+      snprintf(line, sizeof(line), "%lu %s %s", (unsigned long)record.timestampMicros, levelName, record.message);
+    }
+    platformLog(line);
+  }
+  return drained;
+}
+
+uint32_t getLogDroppedCount()
+{
+  return droppedCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
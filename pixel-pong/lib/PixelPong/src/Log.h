@@ -0,0 +1,148 @@
+#ifndef PONGLOG_H
+#define PONGLOG_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  LOG                                                       
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Asynchronous logging for the game.
+ *    The LOG_* macros copy a small binary record (timestamp, level, message
+ *    pointer and optional value) into a lock-free ring buffer, which costs
+ *    nanoseconds and is safe from any task or interrupt. The records are
+ *    formatted and written to the platform log later by logDrain(), called
+ *    from a low priority task (or the simulator loop).
+ *    Messages are stored by pointer, so must be string literals.
+ *    Levels above PONG_LOG_LEVEL are compiled out completely.
+ */
+
+/**
+ * @brief Log levels, in increasing verbosity.
+ */
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+/**
+ * @brief The most verbose level compiled in, set with -DPONG_LOG_LEVEL=n.
+ */
+#ifndef PONG_LOG_LEVEL
+#define PONG_LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+/**
+ * @brief The number of records held before new ones are dropped,
+ *    must be a power of two.
+ */
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 64
+#endif
+
+/**
+ * @brief A single log record, as held in the ring buffer.
+ */
+struct LogRecord
+{
+  uint32_t timestampMicros; /// When the record was written (platform micros).
+  const char *message;      /// The message (a string literal).
+  int32_t value;            /// Optional value logged alongside the message.
+  uint8_t level;            /// The LOG_LEVEL_* of the record.
+  bool hasValue;            /// Whether or not value was given.
+};
+
+/**
+ * @brief Write a record to the ring buffer. Use the LOG_* macros instead,
+ *    so the call can be compiled out.
+ * 
+ * @param level The LOG_LEVEL_* of the record.
+ * @param message The message, must be a string literal.
+ * 
+ * @return Whether or not there was room for the record.
+ */
+bool logWrite(uint8_t level, const char *message);
+
+/**
+ * @brief Write a record with a value to the ring buffer. Use the LOG_*_VALUE
+ *    macros instead, so the call can be compiled out.
+ * 
+ * @param level The LOG_LEVEL_* of the record.
+ * @param message The message, must be a string literal.
+ * @param value The value to log alongside the message.
+ * 
+ * @return Whether or not there was room for the record.
+ */
+bool logWrite(uint8_t level, const char *message, int32_t value);
+
+/**
+ * @brief Take the oldest record from the ring buffer.
+ *    Only one task may read records.
+ * 
+ * @param record Set to the record taken.
+ * 
+ * @return Whether or not there was a record to take.
+ */
+bool logRead(LogRecord &record);
+
+/**
+ * @brief Format and write buffered records to the platform log.
+ *    Only one task may drain the log. When the platform log is disabled
+ *    the records are discarded without being formatted.
+ * 
+ * @param maxRecords The most records to write in one go.
+ * 
+ * @return The number of records taken from the buffer.
+ */
+int logDrain(int maxRecords);
+
+/**
+ * @brief Get the number of records dropped because the buffer was full.
+ */
+uint32_t getLogDroppedCount();
+
+/**
+ * @brief Logging macros, one pair per level.
+ */
+#if PONG_LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(message) logWrite(LOG_LEVEL_ERROR, message)
+#define LOG_ERROR_VALUE(message, value) logWrite(LOG_LEVEL_ERROR, message, value)
+#else
+#define LOG_ERROR(message) ((void)0)
+#define LOG_ERROR_VALUE(message, value) ((void)0)
+#endif
+
+#if PONG_LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(message) logWrite(LOG_LEVEL_WARN, message)
+#define LOG_WARN_VALUE(message, value) logWrite(LOG_LEVEL_WARN, message, value)
+#else
+#define LOG_WARN(message) ((void)0)
+#define LOG_WARN_VALUE(message, value) ((void)0)
+#endif
+
+#if PONG_LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(message) logWrite(LOG_LEVEL_INFO, message)
+#define LOG_INFO_VALUE(message, value) logWrite(LOG_LEVEL_INFO, message, value)
+#else
+#define LOG_INFO(message) ((void)0)
+#define LOG_INFO_VALUE(message, value) ((void)0)
+#endif
+
+#if PONG_LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(message) logWrite(LOG_LEVEL_DEBUG, message)
+#define LOG_DEBUG_VALUE(message, value) logWrite(LOG_LEVEL_DEBUG, message, value)
+#else
+#define LOG_DEBUG(message) ((void)0)
+#define LOG_DEBUG_VALUE(message, value) ((void)0)
+#endif
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGLOG_H
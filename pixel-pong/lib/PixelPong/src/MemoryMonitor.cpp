@@ -0,0 +1,186 @@
+#include "MemoryMonitor.h"
+#include "Platform.h"
+#include "AllocationCounter.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ */
+MemoryMonitor::MemoryMonitor() : taskCount(0)
+{
+  reset();
+}
+
+/**
+ * @brief Watch the stack of a task.
+ * 
+ * @param name Name of the task, must outlive the monitor.
+ * @param task The task @see platformCurrentTask
+ * 
+ * @return Whether or not there was room to watch it.
+ */
+bool MemoryMonitor::watchTask(const char *name, void *task)
+{
+  if (taskCount == MEMORY_MAX_TASKS)
+  {
+    return false;
+  }
+  tasks[taskCount] = task;
+  taskNames[taskCount] = name;
+  taskCount++;
+  return true;
+}
+
+/**
+ * @brief Take a sample from the platform and keep it.
+ */
+void MemoryMonitor::sample()
+{
+  MemorySample sample = {};
+  sample.uptimeMillis = platformMillis();
+  sample.freeHeap = platformFreeHeap();
+  sample.minFreeHeap = platformMinFreeHeap();
+  sample.largestFreeBlock = platformLargestFreeBlock();
+  sample.allocations = getAllocationCount();
+  sample.deallocations = getDeallocationCount();
+  for (int i = 0; i < taskCount; i++)
+  {
+    sample.stackFree[i] = platformStackFree(tasks[i]);
+  }
+  record(sample);
+}
+
+/**
+ * @brief Keep a sample.
+ * 
+ * @param sample The sample.
+ */
+void MemoryMonitor::record(const MemorySample &sample)
+{
+  samples[totalSampleCount % MEMORY_SAMPLE_COUNT] = sample;
+  totalSampleCount++;
+}
+
+/**
+ * @brief Discard every sample kept.
+ */
+void MemoryMonitor::reset()
+{
+  memset(samples, 0, sizeof(samples));
+  totalSampleCount = 0;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of samples kept.
+ */
+int MemoryMonitor::getSampleCount()
+{
+  return totalSampleCount < MEMORY_SAMPLE_COUNT ? totalSampleCount : MEMORY_SAMPLE_COUNT;
+}
+
+/**
+ * @brief Get a sample kept.
+ * 
+ * @param index 0 for the oldest, getSampleCount() - 1 for the latest.
+ */
+const MemorySample &MemoryMonitor::getSample(int index)
+{
+  uint32_t oldest = totalSampleCount - getSampleCount();
+  return samples[(oldest + index) % MEMORY_SAMPLE_COUNT];
+}
+
+/**
+ * @brief Get the number of samples taken since the last reset, kept or not.
+ */
+uint32_t MemoryMonitor::getTotalSampleCount()
+{
+  return totalSampleCount;
+}
+
+/**
+ * @brief Get the number of tasks watched.
+ */
+int MemoryMonitor::getTaskCount()
+{
+  return taskCount;
+}
+
+/**
+ * @brief Get the name of a watched task.
+ * 
+ * @param index The order the task was watched in.
+ */
+const char *MemoryMonitor::getTaskName(int index)
+{
+  return taskNames[index];
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Format the CSV header of a monitor's samples
+ *    (uptime_ms,free_heap,min_free_heap,largest_free_block,fragmentation_pct,
+ *    allocations,deallocations, then <task>_stack_free for each watched task).
+ * 
+ * @param monitor The monitor.
+ * @param buffer The buffer to write the header into.
+ * @param size The size of the buffer.
+ */
+void formatMemoryHeader(MemoryMonitor &monitor, char *buffer, int size)
+{
+  int length = snprintf(buffer, size, "uptime_ms,free_heap,min_free_heap,largest_free_block,fragmentation_pct,allocations,deallocations");
+  for (int i = 0; i < monitor.getTaskCount() && length < size; i++)
+  {
+    length += snprintf(buffer + length, size - length, ",%s_stack_free", monitor.getTaskName(i));
+  }
+}
+
+/**
+ * @brief Format a sample as a CSV row matching formatMemoryHeader.
+ *    Fragmentation is the share of the free heap outside the largest free block.
+ * 
+ * @param monitor The monitor the sample was kept by.
+ * @param sample The sample.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatMemorySample(MemoryMonitor &monitor, const MemorySample &sample, char *buffer, int size)
+{
+  unsigned long fragmentation = sample.freeHeap == 0 ? 0 : 100 - (unsigned long)((uint64_t)sample.largestFreeBlock * 100 / sample.freeHeap);
+  int length = snprintf(buffer, size, "%lu,%lu,%lu,%lu,%lu,%lu,%lu", (unsigned long)sample.uptimeMillis,
+                        (unsigned long)sample.freeHeap, (unsigned long)sample.minFreeHeap, (unsigned long)sample.largestFreeBlock,
+                        fragmentation, (unsigned long)sample.allocations, (unsigned long)sample.deallocations);
+  for (int i = 0; i < monitor.getTaskCount() && length < size; i++)
+  {
+    length += snprintf(buffer + length, size - length, ",%lu", (unsigned long)sample.stackFree[i]);
+  }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
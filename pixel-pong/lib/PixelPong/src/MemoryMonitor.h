@@ -0,0 +1,184 @@
+#ifndef PONGMEMORYMONITOR_H
+#define PONGMEMORYMONITOR_H
+
+#include <stdint.h>
+
+/**
+ * @brief The most tasks whose stacks are watched.
+ */
+#define MEMORY_MAX_TASKS 8
+
+/**
+ * @brief The number of samples kept, the oldest is overwritten.
+ */
+#define MEMORY_SAMPLE_COUNT 64
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The state of memory at a moment in time.
+ */
+struct MemorySample
+{
+  uint32_t uptimeMillis;                /// When the sample was taken (platform millis).
+  uint32_t freeHeap;                    /// Bytes of heap free.
+  uint32_t minFreeHeap;                 /// The least heap that has ever been free.
+  uint32_t largestFreeBlock;            /// The largest block that could be allocated.
+  uint32_t allocations;                 /// Allocations made through operator new since start up.
+  uint32_t deallocations;               /// Deallocations made through operator delete since start up.
+  uint32_t stackFree[MEMORY_MAX_TASKS]; /// Bytes of each watched task's stack that have never been used.
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Keeps a history of the free heap, its fragmentation, the number
+ *    of allocations and the stack high-water mark of each watched task,
+ *    so a long running game can show whether its memory is stable.
+ *    Holds the latest MEMORY_SAMPLE_COUNT samples, never allocates.
+ *    Sampled & read by a single task.
+ */
+class MemoryMonitor
+{
+public:
+  /**
+   * @brief Class constructor.
+   */
+  MemoryMonitor();
+
+  /**
+   * @brief Watch the stack of a task.
+   * 
+   * @param name Name of the task, must outlive the monitor.
+   * @param task The task @see platformCurrentTask
+   * 
+   * @return Whether or not there was room to watch it.
+   */
+  bool watchTask(const char *name, void *task);
+
+  /**
+   * @brief Take a sample from the platform and keep it.
+   */
+  void sample();
+
+  /**
+   * @brief Keep a sample.
+   * 
+   * @param sample The sample.
+   */
+  void record(const MemorySample &sample);
+
+  /**
+   * @brief Discard every sample kept.
+   */
+  void reset();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of samples kept.
+   */
+  int getSampleCount();
+
+  /**
+   * @brief Get a sample kept.
+   * 
+   * @param index 0 for the oldest, getSampleCount() - 1 for the latest.
+   */
+  const MemorySample &getSample(int index);
+
+  /**
+   * @brief Get the number of samples taken since the last reset, kept or not.
+   */
+  uint32_t getTotalSampleCount();
+
+  /**
+   * @brief Get the number of tasks watched.
+   */
+  int getTaskCount();
+
+  /**
+   * @brief Get the name of a watched task.
+   * 
+   * @param index The order the task was watched in.
+   */
+  const char *getTaskName(int index);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The samples kept, in a ring.
+   */
+  MemorySample samples[MEMORY_SAMPLE_COUNT];
+
+  /**
+   * @brief The number of samples taken since the last reset, the next is
+   *    kept at totalSampleCount % MEMORY_SAMPLE_COUNT.
+   */
+  uint32_t totalSampleCount;
+
+  /**
+   * @brief The tasks watched & their names.
+   */
+  void *tasks[MEMORY_MAX_TASKS];
+  const char *taskNames[MEMORY_MAX_TASKS];
+  int taskCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Format the CSV header of a monitor's samples
+ *    (uptime_ms,free_heap,min_free_heap,largest_free_block,fragmentation_pct,
+ *    allocations,deallocations, then <task>_stack_free for each watched task).
+ * 
+ * @param monitor The monitor.
+ * @param buffer The buffer to write the header into.
+ * @param size The size of the buffer.
+ */
+void formatMemoryHeader(MemoryMonitor &monitor, char *buffer, int size);
+
+/**
+ * @brief Format a sample as a CSV row matching formatMemoryHeader.
+ *    Fragmentation is the share of the free heap outside the largest free block.
+ * 
+ * @param monitor The monitor the sample was kept by.
+ * @param sample The sample.
+ * @param buffer The buffer to write the row into.
+ * @param size The size of the buffer.
+ */
+void formatMemorySample(MemoryMonitor &monitor, const MemorySample &sample, char *buffer, int size);
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGMEMORYMONITOR_H
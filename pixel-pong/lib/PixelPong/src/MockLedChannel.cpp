@@ -0,0 +1,85 @@
+#include "MockLedChannel.h"
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param bytesPerPixel The number of colour bytes per pixel.
+ */
+MockLedChannel::MockLedChannel(uint8_t bytesPerPixel)
+    : bytesPerPixel(bytesPerPixel), pixelCount(0), transferCount(0), wireMicros(0)
+{
+  memset(frame, 0, sizeof(frame));
+}
+
+bool MockLedChannel::begin()
+{
+  return true;
+}
+
+void MockLedChannel::show(const uint8_t *pixels, uint16_t numPixels)
+{
+  unsigned long numBytes = (unsigned long)numPixels * bytesPerPixel;
+  memcpy(frame, pixels, numBytes > sizeof(frame) ? sizeof(frame) : numBytes);
+  pixelCount = numPixels;
+  transferCount++;
+  wireMicros += numBytes * MOCK_LED_MICROS_PER_BYTE + MOCK_LED_RESET_MICROS;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get a byte of the last frame sent.
+ * 
+ * @param index The index of the byte.
+ * 
+ * @return The byte, 0 if beyond the frame.
+ */
+uint8_t MockLedChannel::getByte(uint16_t index)
+{
+  if (index >= pixelCount * bytesPerPixel || index >= sizeof(frame))
+  {
+    return 0;
+  }
+  return frame[index];
+}
+
+/**
+ * @brief Get the number of pixels in the last frame sent.
+ */
+uint16_t MockLedChannel::getPixelCount()
+{
+  return pixelCount;
+}
+
+/**
+ * @brief Get the number of frames sent.
+ */
+unsigned long MockLedChannel::getTransferCount()
+{
+  return transferCount;
+}
+
+/**
+ * @brief Get the time all the frames sent would have taken on the wire.
+ */
+unsigned long MockLedChannel::getWireMicros()
+{
+  return wireMicros;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,106 @@
+#ifndef PONGMOCKLEDCHANNEL_H
+#define PONGMOCKLEDCHANNEL_H
+
+#include "LedChannel.h"
+
+/**
+ * @brief The largest frame (in bytes) a MockLedChannel keeps.
+ */
+#ifndef MOCK_LED_MAX_BYTES
+#define MOCK_LED_MAX_BYTES 768
+#endif
+
+#define MOCK_LED_MICROS_PER_BYTE 10 // WS2812 data rate, 800kbit/s
+#define MOCK_LED_RESET_MICROS 320   // Low time that latches a frame, as RmtLedStrip sends
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Output channel that keeps the last frame sent to it instead
+ *    of driving any LEDs, for running a TiledDisplay on the host.
+ *    Also adds up how long the frames would take on the wire, so the
+ *    refresh time of a panel layout can be worked out without hardware.
+ */
+class MockLedChannel : public LedChannel
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param bytesPerPixel The number of colour bytes per pixel.
+   */
+  MockLedChannel(uint8_t bytesPerPixel);
+
+  bool begin();
+
+  void show(const uint8_t *pixels, uint16_t numPixels);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get a byte of the last frame sent.
+   * 
+   * @param index The index of the byte.
+   * 
+   * @return The byte, 0 if beyond the frame.
+   */
+  uint8_t getByte(uint16_t index);
+
+  /**
+   * @brief Get the number of pixels in the last frame sent.
+   */
+  uint16_t getPixelCount();
+
+  /**
+   * @brief Get the number of frames sent.
+   */
+  unsigned long getTransferCount();
+
+  /**
+   * @brief Get the time all the frames sent would have taken on the wire.
+   */
+  unsigned long getWireMicros();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The number of colour bytes per pixel.
+   */
+  uint8_t bytesPerPixel;
+
+  /**
+   * @brief The last frame sent.
+   */
+  uint8_t frame[MOCK_LED_MAX_BYTES];
+
+  /**
+   * @brief The number of pixels in the last frame sent.
+   */
+  uint16_t pixelCount;
+
+  /**
+   * @brief The number of frames sent.
+   */
+  unsigned long transferCount;
+
+  /**
+   * @brief The time the frames sent would have taken on the wire.
+   */
+  unsigned long wireMicros;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGMOCKLEDCHANNEL_H
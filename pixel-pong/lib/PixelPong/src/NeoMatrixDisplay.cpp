@@ -0,0 +1,56 @@
+#ifdef ARDUINO
+
+#include "NeoMatrixDisplay.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param pixelMatrix The Adafruit_NeoMatrix object that will be drawn onto.
+ * @param output The strip output frames are pushed through (optional).
+ */
+NeoMatrixDisplay::NeoMatrixDisplay(Adafruit_NeoMatrix &pixelMatrix, RmtLedStrip *output)
+    : pixelMatrix(pixelMatrix), output(output) {}
+
+void NeoMatrixDisplay::clear()
+{
+  pixelMatrix.clear();
+}
+
+void NeoMatrixDisplay::drawPixel(int16_t x, int16_t y, uint16_t colour)
+{
+  pixelMatrix.drawPixel(x, y, colour);
+}
+
+void NeoMatrixDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+  pixelMatrix.writeFillRect(x, y, w, h, colour);
+}
+
+void NeoMatrixDisplay::show()
+{
+  if (output != NULL)
+  {
+    output->show(pixelMatrix.getPixels(), pixelMatrix.numPixels());
+  }
+  else
+  {
+    pixelMatrix.show();
+  }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
@@ -0,0 +1,65 @@
+#ifndef PONGNEOMATRIXDISPLAY_H
+#define PONGNEOMATRIXDISPLAY_H
+
+#ifdef ARDUINO
+
+#include "Display.h"
+#include "RmtLedStrip.h"
+#include <Adafruit_NeoMatrix.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display backed by an Adafruit_NeoMatrix (the physical LED matrix).
+ *    Drawing goes through the matrix (pixel layout, gamma & brightness),
+ *    frames are pushed out asynchronously by an RmtLedStrip if given,
+ *    otherwise by the matrix's own (blocking) show().
+ *    Only available when building for the device.
+ */
+class NeoMatrixDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param pixelMatrix The Adafruit_NeoMatrix object that will be drawn onto.
+   * @param output The strip output frames are pushed through (optional).
+   */
+  NeoMatrixDisplay(Adafruit_NeoMatrix &pixelMatrix, RmtLedStrip *output = NULL);
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  void show();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The pixel matrix on which rendering will occur.
+   */
+  Adafruit_NeoMatrix &pixelMatrix;
+
+  /**
+   * @brief The strip output frames are pushed through, NULL to use the matrix's show().
+   */
+  RmtLedStrip *output;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
+
+#endif // PONGNEOMATRIXDISPLAY_H
@@ -0,0 +1,44 @@
+#include "NullDisplay.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ */
+NullDisplay::NullDisplay() : showCount(0) {}
+
+void NullDisplay::clear() {}
+
+void NullDisplay::drawPixel(int16_t /*x*/, int16_t /*y*/, uint16_t /*colour*/) {}
+
+void NullDisplay::fillRect(int16_t /*x*/, int16_t /*y*/, int16_t /*w*/, int16_t /*h*/, uint16_t /*colour*/) {}
+
+void NullDisplay::show()
+{
+  showCount++;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of frames that have been shown.
+ */
+unsigned long NullDisplay::getShowCount()
+{
+  return showCount;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,58 @@
+#ifndef PONGNULLDISPLAY_H
+#define PONGNULLDISPLAY_H
+
+#include "Display.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display that discards everything drawn onto it.
+ *    Used for running the game headless (simulation & benchmarking),
+ *    only keeps a count of the frames shown.
+ */
+class NullDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   */
+  NullDisplay();
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  void show();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of frames that have been shown.
+   */
+  unsigned long getShowCount();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The number of frames that have been shown.
+   */
+  unsigned long showCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGNULLDISPLAY_H
@@ -1,4 +1,5 @@
 #include "Paddle.h"
+#include <string.h>
 
 /**
  * ==================================================================================================================
@@ -28,7 +29,11 @@ Paddle::Paddle(
     int anchor,
     Position initialPosition,
     HitRegions regions)
-    : size(size), anchor(anchor), position(initialPosition), regions(regions) {}
+    : size(size), anchor(anchor), position(initialPosition), regions(regions), yMin(0), yMax(-1)
+{
+  memset(rowRegions, NO_COLLISION, sizeof(rowRegions));
+  updateHitRegionLookup();
+}
 
 /**
  * @brief Check when or not an entity being in a given position 
@@ -51,9 +56,12 @@ CollisionRegion Paddle::checkPaddleCollision(Position position)
     return NO_COLLISION;
   }
 
-  int paddleYMax = this->position.y + (this->size - 1 - this->anchor);
-  int paddleYMin = paddleYMax - (this->size - 1);
-  if (position.y <= paddleYMax && position.y >= paddleYMin)
+  if (position.y >= 0 && position.y < PADDLE_LOOKUP_ROWS)
+  {
+    return (CollisionRegion)rowRegions[position.y];
+  }
+  // Beyond the lookup, work it out
+  if (position.y <= yMax && position.y >= yMin)
   {
     return getCollisionHitRegion(position);
   }
@@ -61,6 +69,122 @@ CollisionRegion Paddle::checkPaddleCollision(Position position)
   return NO_COLLISION;
 }
 
+/**
+ * @brief Find the first contact of a ball moving between two positions
+ *    with the face of the Paddle.
+ *    The ball is treated as a pixel sized square, so contact is made when
+ *    its centre reaches the centre of the column in front of the Paddle.
+ *    It is a hit if, carrying on, the ball would enter the Paddle's
+ *    column on one of its rows.
+ * 
+ * @param from The position of the ball at the start of the path.
+ * @param to The position of the ball at the end of the path.
+ * 
+ * @return The time, position and region of contact.
+ *    @see SweptCollision
+ */
+SweptCollision Paddle::sweepPaddleCollision(PrecisePosition from, PrecisePosition to)
+{
+  fixed_t paddleX = intToFixed(this->position.x);
+  fixed_t dx = to.x - from.x;
+  fixed_t contactX;
+  // Approaching from the right
+  if (from.x > paddleX && dx < 0)
+  {
+    contactX = paddleX + FIXED_ONE;
+    if (to.x >= contactX)
+    {
+      return SweptCollision::none();
+    }
+  }
+  // Approaching from the left
+  else if (from.x < paddleX && dx > 0)
+  {
+    contactX = paddleX - FIXED_ONE;
+    if (to.x <= contactX)
+    {
+      return SweptCollision::none();
+    }
+  }
+  else
+  {
+    return SweptCollision::none();
+  }
+
+  // Already past the contact point (i.e. missed), no collision
+  if ((dx < 0 && from.x < contactX) || (dx > 0 && from.x > contactX))
+  {
+    return SweptCollision::none();
+  }
+
+  fixed_t dy = to.y - from.y;
+  fixed_t time = fixedDivide(contactX - from.x, dx);
+  fixed_t contactY = from.y + fixedMultiply(dy, time);
+  // Where the ball would be when entering the Paddle's column (half a pixel on)
+  fixed_t entryY = contactY + (fixed_t)(((int64_t)dy * FIXED_HALF) / fixedAbs(dx));
+
+  if (entryY < intToFixed(yMin) - FIXED_HALF || entryY > intToFixed(yMax) + FIXED_HALF)
+  {
+    return SweptCollision::none();
+  }
+
+  // Row hit, exact halves go to the row the ball came from
+  int rowHit = dy > 0 ? fixedFloor(entryY + FIXED_HALF - 1) : fixedRound(entryY);
+  rowHit = rowHit > yMax ? yMax : (rowHit < yMin ? yMin : rowHit);
+
+  SweptCollision collision = {
+      true,
+      time,
+      PrecisePosition(contactX, contactY),
+      checkPaddleCollision(Position(this->position.x, rowHit))};
+  return collision;
+}
+
+/**
+ * @brief Add the cells covered by the Paddle to a BitBoard.
+ * 
+ * @param mask The BitBoard to add the cells to.
+ */
+void Paddle::fillMask(BitBoard &mask)
+{
+  mask.fillRect(this->position.x, yMin, 1, yMax - yMin + 1);
+}
+
+/**
+ * @brief Add the cells covered by one of the Paddle's hit regions to a BitBoard.
+ *    Matches getCollisionHitRegion, the bottom region is whatever is
+ *    left below the top & middle regions.
+ * 
+ * @param mask The BitBoard to add the cells to.
+ * @param region The hit region.
+ */
+void Paddle::fillHitRegionMask(BitBoard &mask, CollisionRegion region)
+{
+  // Rows of the region, top & bottom inclusive
+  int regionYMax = yMax;
+  int regionYMin = yMin;
+  switch (region)
+  {
+  case TOP:
+    regionYMin = yMax - regions.topSize + 1;
+    break;
+
+  case MIDDLE:
+    regionYMax = yMax - regions.topSize;
+    regionYMin = regionYMax - regions.middleSize + 1;
+    break;
+
+  case BOTTOM:
+    regionYMax = yMax - (regions.topSize + regions.middleSize);
+    break;
+
+  case NO_COLLISION:
+    return;
+  }
+  regionYMin = regionYMin < yMin ? yMin : regionYMin;
+  mask.fillRect(this->position.x, regionYMin, 1, regionYMax - regionYMin + 1);
+}
+
 /**
  * _____________ GETTERS
  */
@@ -88,6 +212,22 @@ Position Paddle::getPosition()
   return this->position;
 }
 
+/**
+ * @brief Get the lowest row covered by the Paddle.
+ */
+int Paddle::getYMin()
+{
+  return this->yMin;
+}
+
+/**
+ * @brief Get the highest row covered by the Paddle.
+ */
+int Paddle::getYMax()
+{
+  return this->yMax;
+}
+
 /**
  * _____________ SETTERS
  */
@@ -100,6 +240,7 @@ Position Paddle::getPosition()
 void Paddle::setSze(int newSize)
 {
   this->size = newSize;
+  updateHitRegionLookup();
 }
 
 /**
@@ -111,6 +252,7 @@ void Paddle::setSze(int newSize)
 void Paddle::setAnchor(int newAnchor)
 {
   this->anchor = newAnchor;
+  updateHitRegionLookup();
 }
 
 /**
@@ -121,6 +263,18 @@ void Paddle::setAnchor(int newAnchor)
 void Paddle::setPosition(Position newPosition)
 {
   this->position = newPosition;
+  updateHitRegionLookup();
+}
+
+/**
+ * @brief Set the Paddle's HitRegions.
+ * 
+ * @param newHitRegions The new HitRegaions of the Paddle.
+ */
+void Paddle::setHitRegions(HitRegions newHitRegions)
+{
+  this->regions = newHitRegions;
+  updateHitRegionLookup();
 }
 
 /**
@@ -139,13 +293,12 @@ void Paddle::setPosition(Position newPosition)
  */
 CollisionRegion Paddle::getCollisionHitRegion(Position position)
 {
-  int paddleYMax = this->position.y + (this->size - 1 - this->anchor);
-  if (position.y <= paddleYMax && position.y > paddleYMax - regions.topSize)
+  if (position.y <= yMax && position.y > yMax - regions.topSize)
   {
     // Top regions
     return TOP;
   }
-  else if (position.y <= paddleYMax - regions.topSize && position.y > paddleYMax - (regions.topSize + regions.middleSize))
+  else if (position.y <= yMax - regions.topSize && position.y > yMax - (regions.topSize + regions.middleSize))
   {
     // Middle region
     return MIDDLE;
@@ -156,6 +309,26 @@ CollisionRegion Paddle::getCollisionHitRegion(Position position)
     return BOTTOM;
   }
 }
+
+/**
+ * @brief Recalculate the rows covered by the paddle and rebuild the hit
+ *    region lookup. Called whenever the paddle moves or changes shape.
+ *    Only the rows the paddle covered before & after are touched.
+ */
+void Paddle::updateHitRegionLookup()
+{
+  for (int y = yMin < 0 ? 0 : yMin; y <= yMax && y < PADDLE_LOOKUP_ROWS; y++)
+  {
+    rowRegions[y] = NO_COLLISION;
+  }
+
+  yMax = this->position.y + (this->size - 1 - this->anchor);
+  yMin = yMax - (this->size - 1);
+  for (int y = yMin < 0 ? 0 : yMin; y <= yMax && y < PADDLE_LOOKUP_ROWS; y++)
+  {
+    rowRegions[y] = getCollisionHitRegion(Position(this->position.x, y));
+  }
+}
 /**
  * ----------------------------------------------------------------------------------------------------------------- 
  * =================================================================================================================
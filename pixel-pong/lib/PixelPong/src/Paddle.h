@@ -2,6 +2,14 @@
 #define PONGPADDLE_H
 
 #include "Helpers.h"
+#include "BitBoard.h"
+
+/**
+ * @brief The rows covered by a Paddle's hit region lookup, i.e. the
+ *    tallest board collisions are answered with a single load for.
+ *    Rows beyond it are worked out from the region sizes.
+ */
+#define PADDLE_LOOKUP_ROWS 64
 
 /**
  * ==================================================================================================================
@@ -45,6 +53,27 @@ enum CollisionRegion
   BOTTOM
 };
 
+/**
+ * @brief Structure for representing the first contact of a moving
+ *    entity with a surface, found by sweeping its path over a timestep.
+ */
+struct SweptCollision
+{
+  bool collided;            /// Whether or not contact was made.
+  fixed_t time;             /// Fraction of the path (0 to 1) travelled at contact.
+  PrecisePosition position; /// Where the entity was at contact.
+  CollisionRegion region;   /// The region hit (paddles only).
+
+  /**
+   * @brief A sweep that made no contact.
+   */
+  static SweptCollision none()
+  {
+    SweptCollision collision = {false, FIXED_ONE, PrecisePosition(0, 0), NO_COLLISION};
+    return collision;
+  }
+};
+
 /**
  * ----------------------------------------------------------------------------------------------------------------- 
  * =================================================================================================================
@@ -99,6 +128,37 @@ public:
    */
   CollisionRegion checkPaddleCollision(Position position);
 
+  /**
+   * @brief Find the first contact of a ball moving between two positions
+   *    with the face of the Paddle.
+   *    The ball is treated as a pixel sized square, so contact is made when
+   *    its centre reaches the centre of the column in front of the Paddle.
+   *    It is a hit if, carrying on, the ball would enter the Paddle's
+   *    column on one of its rows.
+   * 
+   * @param from The position of the ball at the start of the path.
+   * @param to The position of the ball at the end of the path.
+   * 
+   * @return The time, position and region of contact.
+   *    @see SweptCollision
+   */
+  SweptCollision sweepPaddleCollision(PrecisePosition from, PrecisePosition to);
+
+  /**
+   * @brief Add the cells covered by the Paddle to a BitBoard.
+   * 
+   * @param mask The BitBoard to add the cells to.
+   */
+  void fillMask(BitBoard &mask);
+
+  /**
+   * @brief Add the cells covered by one of the Paddle's hit regions to a BitBoard.
+   * 
+   * @param mask The BitBoard to add the cells to.
+   * @param region The hit region.
+   */
+  void fillHitRegionMask(BitBoard &mask, CollisionRegion region);
+
   /**
    * _____________ GETTERS
    */
@@ -118,6 +178,16 @@ public:
    */
   Position getPosition();
 
+  /**
+   * @brief Get the lowest row covered by the Paddle.
+   */
+  int getYMin();
+
+  /**
+   * @brief Get the highest row covered by the Paddle.
+   */
+  int getYMax();
+
   /**
    * _____________ SETTERS
    */
@@ -176,6 +246,19 @@ private:
    */
   HitRegions regions;
 
+  /**
+   * @brief The lowest & highest rows covered by the paddle.
+   */
+  int yMin;
+  int yMax;
+
+  /**
+   * @brief The CollisionRegion of each row of the paddle's column, NO_COLLISION
+   *    off the paddle. Rebuilt whenever the paddle moves or changes shape
+   *    so collision queries are a single load.
+   */
+  uint8_t rowRegions[PADDLE_LOOKUP_ROWS];
+
   /**
    * _____________ METHODS
    */
@@ -191,6 +274,12 @@ private:
    *     @see CollisionRegion
    */
   CollisionRegion getCollisionHitRegion(Position position);
+
+  /**
+   * @brief Recalculate the rows covered by the paddle and rebuild the hit
+   *    region lookup. Called whenever the paddle moves or changes shape.
+   */
+  void updateHitRegionLookup();
 };
 
 /**
@@ -0,0 +1,106 @@
+#include "PaddleController.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param paddle The paddle to be controlled.
+ * @param sensor The sensor acting as the controller.
+ * @param validPositions The valid Y coordinates of the paddle.
+ * @param heightLower Distance in cm below which the paddle is in the first position.
+ * @param heightIncrement Distance in cm covered by each subsequent position.
+ */
+PaddleController::PaddleController(
+    Paddle &paddle,
+    DistanceSensor &sensor,
+    const PaddlePositions &validPositions,
+    int heightLower,
+    int heightIncrement)
+    : paddle(paddle),
+      sensor(sensor),
+      validPositions(validPositions),
+      heightLower(heightLower),
+      heightIncrement(heightIncrement) {}
+
+/**
+ * @brief Move the paddle to match the latest sensor reading (if there
+ *    is one, otherwise it stays put) and trigger the next reading.
+ */
+void PaddleController::update()
+{
+  int distance;
+  if (sensor.getDistance(distance))
+  {
+    int paddleXPosition = paddle.getPosition().x;
+    paddle.setPosition({paddleXPosition, validPositions.positions[getPositionIndex(distance)]});
+  }
+  sensor.trigger();
+}
+
+/**
+ * @brief Get the index of the valid position corresponding to a distance.
+ * 
+ * @param distance The distance in cm.
+ * 
+ * @return Index into the valid positions.
+ */
+int PaddleController::getPositionIndex(int distance)
+{
+  if (distance < heightLower)
+  {
+    return 0;
+  }
+  else if (distance >= heightLower * validPositions.count)
+  {
+    return validPositions.count - 1;
+  }
+  int rounded = ((distance + heightIncrement - 1) / heightIncrement) * heightIncrement;
+  return (rounded / heightIncrement) - 1;
+}
+
+/**
+ * @brief Get a distance that maps onto a valid position, the inverse
+ *    of getPositionIndex.
+ * 
+ * @param index Index into the valid positions.
+ * 
+ * @return A distance in cm.
+ */
+int PaddleController::getDistanceForIndex(int index)
+{
+  if (index <= 0)
+  {
+    return 0;
+  }
+  else if (index >= validPositions.count - 1)
+  {
+    return heightLower * validPositions.count;
+  }
+  return index * heightIncrement + 1;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the sensor acting as the controller.
+ */
+DistanceSensor &PaddleController::getSensor()
+{
+  return sensor;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,110 @@
+#ifndef PONGPADDLECONTROLLER_H
+#define PONGPADDLECONTROLLER_H
+
+#include "Paddle.h"
+#include "Board.h"
+#include "DistanceSensor.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Handles user control of a paddle.
+ *    Maps the latest reading of a distance sensor (the height the player
+ *    holds the controller at) onto one of the paddle's valid positions.
+ *    Never blocks waiting for the sensor.
+ */
+class PaddleController
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param paddle The paddle to be controlled.
+   * @param sensor The sensor acting as the controller.
+   * @param validPositions The valid Y coordinates of the paddle.
+   * @param heightLower Distance in cm below which the paddle is in the first position.
+   * @param heightIncrement Distance in cm covered by each subsequent position.
+   *    Should be no less than heightLower.
+   */
+  PaddleController(
+      Paddle &paddle,
+      DistanceSensor &sensor,
+      const PaddlePositions &validPositions,
+      int heightLower,
+      int heightIncrement);
+
+  /**
+   * @brief Move the paddle to match the latest sensor reading (if there
+   *    is one, otherwise it stays put) and trigger the next reading.
+   */
+  void update();
+
+  /**
+   * @brief Get the index of the valid position corresponding to a distance.
+   * 
+   * @param distance The distance in cm.
+   * 
+   * @return Index into the valid positions.
+   */
+  int getPositionIndex(int distance);
+
+  /**
+   * @brief Get a distance that maps onto a valid position, the inverse
+   *    of getPositionIndex. Used to drive simulated sensors.
+   * 
+   * @param index Index into the valid positions.
+   * 
+   * @return A distance in cm.
+   */
+  int getDistanceForIndex(int index);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the sensor acting as the controller.
+   */
+  DistanceSensor &getSensor();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The paddle being controlled.
+   */
+  Paddle &paddle;
+
+  /**
+   * @brief The sensor acting as the controller.
+   */
+  DistanceSensor &sensor;
+
+  /**
+   * @brief The valid Y coordinates of the paddle.
+   */
+  const PaddlePositions &validPositions;
+
+  /**
+   * @brief Distance in cm below which the paddle is in the first position.
+   */
+  int heightLower;
+
+  /**
+   * @brief Distance in cm covered by each subsequent position.
+   */
+  int heightIncrement;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGPADDLECONTROLLER_H
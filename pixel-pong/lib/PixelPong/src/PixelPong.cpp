@@ -1,12 +1,7 @@
 #include "PixelPong.h"
-#include <iostream>
-#include <Arduino.h>
-#include <Wire.h>
-#include <SPI.h>
-#include <Adafruit_I2CDevice.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_NeoMatrix.h>
-#include <Adafruit_NeoPixel.h>
+#include "Log.h"
+#include "InputLog.h"
+#include "Trace.h"
 #include <tuple>
 /**
  * ==================================================================================================================
@@ -21,23 +16,24 @@
 /**
  * @brief Class constructor.
  * 
- * @param pixelMatrix The Adafruit_NeoMatrix object that will be used for 
- *    rendering.
+ * @param display The display that will be used for rendering.
  * @param board The pong game board.
  * @param ball The pong ball.
  * @param paddle1 One of the pong paddles.
  * @param paddle2 One of the pong paddles.
+ * @param random The generator used for random rebounds.
  */
 PixelPong::PixelPong(
-    Adafruit_NeoMatrix &pixelMatrix,
+    Display &display,
     Board &board,
     Ball &ball,
     Paddle &paddle1,
-    Paddle &paddle2)
-    : pixelMatrix(pixelMatrix), board(board), ball(ball), paddle1(paddle1), paddle2(paddle2) {}
+    Paddle &paddle2,
+    Random &random)
+    : display(display), board(board), ball(ball), paddle1(paddle1), paddle2(paddle2), random(random), paddleCollisionCounter(0), inputLog(NULL) {}
 
 /**
-   * @brief Renders the current game state onto the pixel matrix.
+   * @brief Renders the current game state onto the display.
    * 
    * @param ballColour The RBG colour values of the ball.
    * @param paddle1Colour The RBG colour values of paddle 1.
@@ -46,97 +42,66 @@ PixelPong::PixelPong(
    */
 void PixelPong::render(std::tuple<uint16_t, uint16_t, uint16_t> ballColour, std::tuple<uint16_t, uint16_t, uint16_t> paddle1Colour, std::tuple<uint16_t, uint16_t, uint16_t> paddle2Colour)
 {
-  pixelMatrix.clear();
+  TRACE_SCOPE(TRACE_RENDER);
+  display.clear();
   renderBall(ball, ballColour);
   renderPaddle(paddle1, paddle1Colour);
   renderPaddle(paddle2, paddle2Colour);
-  pixelMatrix.show();
+  display.show();
 }
 
 /**
  * @brief Coordinate game elements to handle updating of game state, 
  *    collisions, win states, etc.
  *    Main function of the class, used to advance the game.
+ *    The ball's path over the timestep is swept for contacts with the
+ *    board boundaries and paddles, each is resolved in the order it happens
+ *    before the rest of the path is followed. So the ball can't tunnel
+ *    through anything, no matter how fast it's moving.
+ *    Each timestep is recorded into the input log, if there is one.
  */
 bool PixelPong::handle()
 {
-  // Before any updates
-  Position initialBallPosition = ball.getPosition();
-  Velocity initialBallVelocity = ball.getVelocity();
-  // After updates
-  ball.updatePosition();
-  Position newBallPosition = ball.getPosition();
-
-  if (board.checkWinState(newBallPosition))
-  {
-    return true;
-  }
+  TRACE_SCOPE(TRACE_HANDLE);
+  int paddle1Y = paddle1.getPosition().y;
+  int paddle2Y = paddle2.getPosition().y;
+  bool win = step();
+  recordStep(paddle1Y, paddle2Y, win);
+  return win;
+}
 
-  // Check if new location is a collision with bard boundaries
-  if (board.checkBoundaryCollision(newBallPosition))
-  {
-    handleBoundaryCollision(initialBallVelocity);
-    // Change position and update to simulate a rebound
-    ball.setPosition(initialBallPosition);
-    ball.updatePosition();
-    // For the edge case that it hits the corner of the paddle, so the paddle collision check can catch it.
-    newBallPosition = ball.getPosition();
-  }
+/**
+ * _____________ GETTERS
+ */
 
-  // Ball is moving diagonally - need to do some corrections for visuals
-  if (initialBallVelocity.y != 0)
+/**
+ * @brief Get a hash of everything that decides how the game plays out
+ *    from here: the ball, the paddles, the collision count & the state
+ *    of the generator. Two games with the same hash play the same.
+ * 
+ * @return The hash (32 bit FNV-1a).
+ */
+uint32_t PixelPong::getStateHash()
+{
+  PrecisePosition position = ball.getPrecisePosition();
+  Velocity velocity = ball.getVelocity();
+  uint32_t values[] = {
+      (uint32_t)position.x, (uint32_t)position.y,
+      (uint32_t)velocity.x, (uint32_t)velocity.y,
+      (uint32_t)paddle1.getPosition().y, (uint32_t)paddle2.getPosition().y,
+      (uint32_t)paddleCollisionCounter, random.getState()};
+  uint32_t hash = 2166136261u;
+  for (uint32_t value : values)
   {
-    // Check for lateral collision - move ball one step to left for right
-    Position lateralBallPosition = Position(initialBallPosition.x + initialBallVelocity.x, initialBallPosition.y);
-
-    // Check for edge collision
-    CollisionRegion paddle1CollisionRegion = paddle1.checkPaddleCollision(lateralBallPosition);
-    CollisionRegion paddle2CollisionRegion = paddle2.checkPaddleCollision(lateralBallPosition);
-    // If this position caused a collision, use this one instead of the ball.updatePostion one.
-    // This prevents the ball from 'phasing' to an unexpected position.
-    if (paddle1CollisionRegion != NO_COLLISION || paddle2CollisionRegion != NO_COLLISION)
+    // A byte at a time, so the hash is the same whatever the endianness
+    for (int i = 0; i < 4; i++)
     {
-      newBallPosition = lateralBallPosition;
+      hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 16777619u;
     }
   }
-  // Check for collision with either of the paddles
-  CollisionRegion paddle1CollisionRegion = paddle1.checkPaddleCollision(newBallPosition);
-  CollisionRegion paddle2CollisionRegion = paddle2.checkPaddleCollision(newBallPosition);
-  if (paddle1CollisionRegion != NO_COLLISION || paddle2CollisionRegion != NO_COLLISION)
-  {
-    // If there's been a collision handle it.
-    if (paddle1CollisionRegion != NO_COLLISION)
-    {
-      Serial.println("PADDLE1 COLLISION");
-      handlePaddleCollision(initialBallVelocity, paddle1CollisionRegion);
-      ball.setPosition(initialBallPosition);
-      // Edge case handling
-      if (initialBallPosition.y > 0 && initialBallPosition.y < board.getYDim() - 1)
-      {
-        ball.updatePosition();
-      }
-      this->paddleCollisionCounter++;
-    }
-    if (paddle2CollisionRegion != NO_COLLISION)
-    {
-      Serial.println("PADDLE1 COLLISION");
-      handlePaddleCollision(initialBallVelocity, paddle2CollisionRegion);
-      ball.setPosition(initialBallPosition);
-      // Edge case handling
-      if (initialBallPosition.y > 0 && initialBallPosition.y < board.getYDim() - 1)
-      {
-        ball.updatePosition();
-      }
-      this->paddleCollisionCounter++;
-    }
-  }
-  return false;
+  return hash;
 }
 
-/**
- * _____________ GETTERS
- */
-
 /**
  * @brief Get the current count for the nuber of 
  *    times the ball has collided with a paddle.
@@ -161,11 +126,106 @@ void PixelPong::setCollisionCount(int collisionCount)
 {
   this->paddleCollisionCounter = collisionCount;
 }
+
+/**
+ * @brief Record every timestep into a log (paddle positions for the
+ *    step & the state hash after it), so the game can be replayed.
+ * 
+ * @param inputLog The log, NULL to stop recording.
+ */
+void PixelPong::setInputLog(InputLog *inputLog)
+{
+  this->inputLog = inputLog;
+}
 /**
  * <                               PRIVATE
  * ---------------------------------------
 */
 
+/**
+ * @brief Advance the game by one timestep, sweeping the ball's path.
+ */
+bool PixelPong::step()
+{
+  // Fraction of the timestep the ball still has to move for
+  fixed_t remaining = FIXED_ONE;
+  for (int i = 0; i < MAX_COLLISIONS_PER_TIMESTEP && remaining > 0; i++)
+  {
+    Velocity ballVelocity = ball.getVelocity();
+    PrecisePosition from = ball.getPrecisePosition();
+    PrecisePosition to = PrecisePosition(
+        from.x + fixedMultiply(ballVelocity.x, remaining),
+        from.y + fixedMultiply(ballVelocity.y, remaining));
+
+    // Find the first contact along the path.
+    // Paddles win ties, for the edge case that the ball hits the corner of a paddle.
+    SweptCollision collision = board.sweepBoundaryCollision(from, to);
+    Paddle *paddleHit = NULL;
+    SweptCollision paddle1Collision = paddle1.sweepPaddleCollision(from, to);
+    if (paddle1Collision.collided && (!collision.collided || paddle1Collision.time <= collision.time))
+    {
+      collision = paddle1Collision;
+      paddleHit = &paddle1;
+    }
+    SweptCollision paddle2Collision = paddle2.sweepPaddleCollision(from, to);
+    if (paddle2Collision.collided && (!collision.collided || paddle2Collision.time <= collision.time))
+    {
+      collision = paddle2Collision;
+      paddleHit = &paddle2;
+    }
+
+    if (!collision.collided)
+    {
+      ball.setPrecisePosition(to);
+      break;
+    }
+
+    // Move up to the contact and rebound, the rest of the path is followed next time round
+    ball.setPrecisePosition(collision.position);
+    remaining = fixedMultiply(remaining, FIXED_ONE - collision.time);
+    if (paddleHit == NULL)
+    {
+      handleBoundaryCollision(ballVelocity);
+      continue;
+    }
+
+    LOG_INFO(paddleHit == &paddle1 ? "PADDLE1 COLLISION" : "PADDLE2 COLLISION");
+    handlePaddleCollision(ballVelocity, collision.region);
+    this->paddleCollisionCounter++;
+    // Edge case handling - on the top/bottom row the ball stays put for the rest of the timestep
+    Position contactPosition = ball.getPosition();
+    if (contactPosition.y <= 0 || contactPosition.y >= board.getYDim() - 1)
+    {
+      remaining = 0;
+    }
+  }
+
+  return board.checkWinState(ball.getPosition());
+}
+
+/**
+ * @brief Record a timestep into the input log, if there is one.
+ *    Every INPUT_LOG_CHECKPOINT_STEPS steps, and at the end of a game,
+ *    the full hash is recorded as well as the 8 bits kept for each step.
+ * 
+ * @param paddle1Y Paddle 1's Y-coordinate for the step.
+ * @param paddle2Y Paddle 2's Y-coordinate for the step.
+ * @param win Whether or not the step ended in a win.
+ */
+void PixelPong::recordStep(int paddle1Y, int paddle2Y, bool win)
+{
+  if (inputLog == NULL)
+  {
+    return;
+  }
+  uint32_t stateHash = getStateHash();
+  inputLog->recordStep(paddle1Y, paddle2Y, stateHash);
+  if (win || inputLog->getStepCount() % INPUT_LOG_CHECKPOINT_STEPS == 0)
+  {
+    inputLog->recordCheckpoint(stateHash);
+  }
+}
+
 /**
  * @brief Handle to ball hitting the (upper & lower) boundaries
  *    of the board. Updates the balls velocity appropriately.
@@ -190,18 +250,18 @@ void PixelPong::handlePaddleCollision(Velocity ballVelocity, CollisionRegion col
   switch (collisionRegion)
   {
   case TOP:
-    Serial.println("TOP");
-    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL, true));
+    LOG_DEBUG("TOP");
+    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL, &random));
     break;
 
   case MIDDLE:
-    Serial.println("MIDDLE");
-    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL, false));
+    LOG_DEBUG("MIDDLE");
+    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL));
     break;
 
   case BOTTOM:
-    Serial.println("BOTTOM");
-    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL, true));
+    LOG_DEBUG("BOTTOM");
+    ball.setVelocity(reboundVelocity(ballVelocity, VERTICAL, &random));
     break;
 
   case NO_COLLISION:
@@ -210,26 +270,31 @@ void PixelPong::handlePaddleCollision(Velocity ballVelocity, CollisionRegion col
 }
 
 /**
- * @brief Render the ball on the pixel matrix.
+ * @brief Render the ball on the display.
  * 
  * @param The ball to render.
 */
 void PixelPong::renderBall(Ball &ball, std::tuple<uint16_t, uint16_t, uint16_t> colour)
 {
-  pixelMatrix.drawPixel(ball.getPosition().x, ball.getPosition().y, pixelMatrix.Color(std::get<0>(colour), std::get<1>(colour), std::get<2>(colour)));
+  display.drawPixel(ball.getPosition().x, ball.getPosition().y, Display::colour(std::get<0>(colour), std::get<1>(colour), std::get<2>(colour)));
 }
 
 /**
- * @brief Render the paddle on the pixel matrix.
+ * @brief Render the paddle on the display.
+ *    Built with PONG_BITBOARD the paddle is drawn from its BitBoard mask.
  * 
  * @param The paddle to render.
 */
 void PixelPong::renderPaddle(Paddle &paddle, std::tuple<uint16_t, uint16_t, uint16_t> colour)
 {
-  int paddleYMax = paddle.getPosition().y + (paddle.getSize() - 1 - paddle.getAnchorIndex());
-  int paddleYMin = paddleYMax - (paddle.getSize() - 1);
-
-  pixelMatrix.writeFillRect(paddle.getPosition().x, paddleYMin, 1, paddleYMax - paddleYMin + 1, pixelMatrix.Color(std::get<0>(colour), std::get<1>(colour), std::get<2>(colour)));
+#ifdef PONG_BITBOARD
+  // The paddle's cells as a mask, expanded to pixels
+  BitBoard mask(board.getXDim(), board.getYDim());
+  paddle.fillMask(mask);
+  mask.render(display, Display::colour(std::get<0>(colour), std::get<1>(colour), std::get<2>(colour)));
+#else
+  display.fillRect(paddle.getPosition().x, paddle.getYMin(), 1, paddle.getYMax() - paddle.getYMin() + 1, Display::colour(std::get<0>(colour), std::get<1>(colour), std::get<2>(colour)));
+#endif
 }
 /**
  * ----------------------------------------------------------------------------------------------------------------- 
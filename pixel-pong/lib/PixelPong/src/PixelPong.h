@@ -5,7 +5,17 @@
 #include "Ball.h"
 #include "Paddle.h"
 #include "Board.h"
-#include <Adafruit_NeoMatrix.h>
+#include "Display.h"
+#include <stdint.h>
+#include <tuple>
+
+/**
+ * @brief The most contacts resolved in a single timestep,
+ *    guards against the ball getting wedged between surfaces.
+ */
+#define MAX_COLLISIONS_PER_TIMESTEP 8
+
+class InputLog;
 
 /**
  * ==================================================================================================================
@@ -22,22 +32,25 @@ public:
   /**
    * @brief Class constructor.
    * 
-   * @param pixelMatrix The Adafruit_NeoMatrix object that will be used for 
-   *    rendering.
+   * @param display The display that will be used for rendering.
+   *    @see Display
    * @param board The pong game board.
    * @param ball The pong ball.
    * @param paddle1 One of the pong paddles.
    * @param paddle2 One of the pong paddles.
+   * @param random The generator used for random rebounds, seeding it
+   *    the same way replays the same game.
    */
   PixelPong(
-      Adafruit_NeoMatrix &pixelMatrix,
+      Display &display,
       Board &board,
       Ball &ball,
       Paddle &paddle1,
-      Paddle &paddle2);
+      Paddle &paddle2,
+      Random &random);
 
   /**
-   * @brief Renders the current game state onto the pixel matrix.
+   * @brief Renders the current game state onto the display.
    * 
    * @param ballColour The RBG colour values of the ball.
    * @param paddle1Colour The RBG colour values of paddle 1.
@@ -49,7 +62,12 @@ public:
   /**
    * @brief Coordinate game elements to handle updating of game state, 
    *    collisions, win states, etc.
-   *    Main function of the class, used to advance the game.
+   *    Main function of the class, used to advance the game
+   *    by one timestep.
+   *    The ball's path is swept for contacts, so it can't tunnel
+   *    through a paddle or the boundaries at any speed.
+   * 
+   * @return Whether or not the ball has left the board (a win).
    */
   bool handle();
 
@@ -57,6 +75,15 @@ public:
    * _____________ GETTERS
    */
 
+  /**
+   * @brief Get a hash of everything that decides how the game plays out
+   *    from here: the ball, the paddles, the collision count & the state
+   *    of the generator. Two games with the same hash play the same.
+   * 
+   * @return The hash (32 bit FNV-1a).
+   */
+  uint32_t getStateHash();
+
   /**
    * @brief Get the current count for the nuber of 
    *    times the ball has collided with a paddle.
@@ -77,15 +104,24 @@ public:
    */
   void setCollisionCount(int collisionCount);
 
+  /**
+   * @brief Record every timestep into a log (paddle positions for the
+   *    step & the state hash after it), so the game can be replayed.
+   *    @see InputLog
+   * 
+   * @param inputLog The log, NULL to stop recording.
+   */
+  void setInputLog(InputLog *inputLog);
+
 private:
   /**
    * _____________ MEMEBER VARIABLES
    */
 
   /**
-   * @brief The pixel matrix on which rendering will occur.
+   * @brief The display on which rendering will occur.
    */
-  Adafruit_NeoMatrix &pixelMatrix;
+  Display &display;
 
   /**
    * @brief The pong board.
@@ -107,24 +143,49 @@ private:
    */
   Paddle &paddle2;
 
+  /**
+   * @brief The generator used for random rebounds.
+   */
+  Random &random;
+
   /**
    * @brief The number of times the ball has collided with a paddle.
    */
   int paddleCollisionCounter;
 
+  /**
+   * @brief Where timesteps are recorded, NULL if they aren't.
+   */
+  InputLog *inputLog;
+
   /**
    * _____________ METHODS
    */
 
   /**
-   * @brief Render the ball on the pixel matrix.
+   * @brief Advance the game by one timestep, sweeping the ball's path.
+   *    @see PixelPong::handle
+   */
+  bool step();
+
+  /**
+   * @brief Record a timestep into the input log, if there is one.
+   * 
+   * @param paddle1Y Paddle 1's Y-coordinate for the step.
+   * @param paddle2Y Paddle 2's Y-coordinate for the step.
+   * @param win Whether or not the step ended in a win.
+   */
+  void recordStep(int paddle1Y, int paddle2Y, bool win);
+
+  /**
+   * @brief Render the ball on the display.
    * 
    * @param The ball to render.
   */
   void renderBall(Ball &ball, std::tuple<uint16_t, uint16_t, uint16_t> colour);
 
   /**
-   * @brief Render the paddle on the pixel matrix.
+   * @brief Render the paddle on the display.
    * 
    * @param The paddle to render.
   */
@@ -0,0 +1,218 @@
+#include "Platform.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+/**
+ * ==================================================================================================================
+ * ~                                               PLATFORM                                                     
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Whether or not log messages are currently being written.
+ */
+static bool logEnabled = true;
+
+void platformSetLogEnabled(bool enabled)
+{
+  logEnabled = enabled;
+}
+
+bool platformIsLogEnabled()
+{
+  return logEnabled;
+}
+
+#ifdef ARDUINO
+
+/**
+ * >                               ARDUINO
+ * ---------------------------------------
+*/
+unsigned long platformMillis()
+{
+  return millis();
+}
+
+unsigned long IRAM_ATTR platformMicros()
+{
+  return micros();
+}
+
+uint32_t platformCycleCount()
+{
+  return ESP.getCycleCount();
+}
+
+void *platformCurrentTask()
+{
+  return xTaskGetCurrentTaskHandle();
+}
+
+const char *platformCurrentTaskName()
+{
+  return pcTaskGetTaskName(NULL);
+}
+
+int IRAM_ATTR platformCoreId()
+{
+  return xPortGetCoreID();
+}
+
+bool IRAM_ATTR platformInInterrupt()
+{
+  return xPortInIsrContext();
+}
+
+uint32_t platformFreeHeap()
+{
+  return ESP.getFreeHeap();
+}
+
+uint32_t platformMinFreeHeap()
+{
+  return ESP.getMinFreeHeap();
+}
+
+uint32_t platformLargestFreeBlock()
+{
+  return ESP.getMaxAllocHeap();
+}
+
+uint32_t platformStackFree(void *task)
+{
+  // Counted in bytes on the ESP32, not words
+  return uxTaskGetStackHighWaterMark((TaskHandle_t)task);
+}
+
+uint32_t platformRandomSeed()
+{
+  return esp_random();
+}
+
+void platformLog(const char *message)
+{
+  if (logEnabled)
+  {
+    Serial.println(message);
+  }
+}
+
+void platformLog(long value)
+{
+  if (logEnabled)
+  {
+    Serial.println(value);
+  }
+}
+
+#else
+
+/**
+ * >                                NATIVE
+ * ---------------------------------------
+*/
+/**
+ * @brief The moment the program started, used as the epoch for
+ *    platformMillis() and platformMicros() to mirror the Arduino behaviour.
+ */
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+unsigned long platformMillis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long platformMicros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint32_t platformCycleCount()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return (uint32_t)__rdtsc();
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+#endif
+}
+
+void *platformCurrentTask()
+{
+  // A different address in every thread
+  static thread_local char task;
+  return &task;
+}
+
+const char *platformCurrentTaskName()
+{
+  return "main";
+}
+
+int platformCoreId()
+{
+  return 0;
+}
+
+bool platformInInterrupt()
+{
+  return false;
+}
+
+uint32_t platformFreeHeap()
+{
+  return 0;
+}
+
+uint32_t platformMinFreeHeap()
+{
+  return 0;
+}
+
+uint32_t platformLargestFreeBlock()
+{
+  return 0;
+}
+
+uint32_t platformStackFree(void *)
+{
+  return 0;
+}
+
+uint32_t platformRandomSeed()
+{
+  std::random_device device;
+  return device();
+}
+
+void platformLog(const char *message)
+{
+  if (logEnabled)
+  {
+    printf("%s\n", message);
+  }
+}
+
+void platformLog(long value)
+{
+  if (logEnabled)
+  {
+    printf("%ld\n", value);
+  }
+}
+
+#endif
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,145 @@
+#ifndef PONGPLATFORM_H
+#define PONGPLATFORM_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                               PLATFORM                                                     
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Thin hardware abstraction for the services the game library needs
+ *    from the platform it is running on (time and logging).
+ *    On the ESP32 these are backed by the Arduino core, everywhere else
+ *    (i.e. env:native) by the C++ standard library.
+ */
+
+/**
+ * @brief Get the number of milliseconds since the program started.
+ * 
+ * @return Milliseconds since start up.
+ */
+unsigned long platformMillis();
+
+/**
+ * @brief Get the number of microseconds since the program started.
+ * 
+ * @return Microseconds since start up.
+ */
+unsigned long platformMicros();
+
+/**
+ * @brief Read the free running CPU cycle counter (CCOUNT on the ESP32,
+ *    the time stamp counter on x86 hosts, nanoseconds elsewhere).
+ *    Only 32 bits wide so it wraps (every ~18s at 240MHz), intervals
+ *    should be measured as the unsigned difference of two short-spaced reads.
+ * 
+ * @return The current cycle count.
+ */
+uint32_t platformCycleCount();
+
+/**
+ * @brief Get whatever identifies the task (thread natively) currently running.
+ * 
+ * @return A pointer unique to the task, only meaningful when compared.
+ */
+void *platformCurrentTask();
+
+/**
+ * @brief Get the name of the task currently running.
+ * 
+ * @return The name, valid for as long as the task lives.
+ */
+const char *platformCurrentTaskName();
+
+/**
+ * @brief Get the core the caller is running on (always 0 natively).
+ * 
+ * @return The core.
+ */
+int platformCoreId();
+
+/**
+ * @brief Check whether the caller is running in an interrupt (never natively).
+ * 
+ * @return Whether or not in an interrupt.
+ */
+bool platformInInterrupt();
+
+/**
+ * @brief Get the number of bytes of heap free (0 natively, where it isn't known).
+ * 
+ * @return Free heap in bytes.
+ */
+uint32_t platformFreeHeap();
+
+/**
+ * @brief Get the least heap that has been free since start up (0 natively).
+ * 
+ * @return Low water mark of the free heap in bytes.
+ */
+uint32_t platformMinFreeHeap();
+
+/**
+ * @brief Get the largest block of heap that could be allocated right now,
+ *    much less than the free heap once it is fragmented (0 natively).
+ * 
+ * @return Largest free block in bytes.
+ */
+uint32_t platformLargestFreeBlock();
+
+/**
+ * @brief Get how much of a task's stack has never been used, its
+ *    high-water mark (0 natively).
+ * 
+ * @param task The task @see platformCurrentTask
+ * 
+ * @return Stack never used in bytes.
+ */
+uint32_t platformStackFree(void *task);
+
+/**
+ * @brief Get a seed for the game's Random that differs from run to run
+ *    (the hardware RNG on the ESP32, the OS's entropy natively).
+ * 
+ * @return The seed.
+ */
+uint32_t platformRandomSeed();
+
+/**
+ * @brief Write a line to the platform log (Serial on the ESP32, stdout natively).
+ * 
+ * @param message The message to be logged.
+ */
+void platformLog(const char *message);
+
+/**
+ * @brief Write a number to the platform log on its own line.
+ * 
+ * @param value The value to be logged.
+ */
+void platformLog(long value);
+
+/**
+ * @brief Enable or disable the platform log. Useful for the headless
+ *    simulator where logging every collision would dominate the run time.
+ * 
+ * @param enabled Whether or not messages should be written.
+ */
+void platformSetLogEnabled(bool enabled);
+
+/**
+ * @brief Check whether the platform log is enabled.
+ * 
+ * @return Whether or not messages are being written.
+ */
+bool platformIsLogEnabled();
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGPLATFORM_H
@@ -0,0 +1,51 @@
+#include "PpmDisplay.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param stream The stream the frames are written to.
+ * @param width The width of the display in pixels.
+ * @param height The height of the display in pixels.
+ * @param scale How many image pixels wide (& high) each display pixel is.
+ */
+PpmDisplay::PpmDisplay(FILE *stream, int16_t width, int16_t height, int scale)
+    : FrameBufferDisplay(width, height), stream(stream), scale(scale < 1 ? 1 : scale) {}
+
+/**
+ * @brief Write the frame out as a PPM image.
+ */
+void PpmDisplay::show()
+{
+  FrameBufferDisplay::show();
+  fprintf(stream, "P6\n%d %d\n255\n", width * scale, height * scale);
+  for (int16_t y = 0; y < height; y++)
+  {
+    for (int row = 0; row < scale; row++)
+    {
+      for (int16_t x = 0; x < width; x++)
+      {
+        uint8_t rgb[3];
+        Display::colourComponents(frame[y * width + x], rgb[0], rgb[1], rgb[2]);
+        for (int column = 0; column < scale; column++)
+        {
+          fwrite(rgb, 1, sizeof(rgb), stream);
+        }
+      }
+    }
+  }
+  fflush(stream);
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
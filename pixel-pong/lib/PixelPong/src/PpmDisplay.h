@@ -0,0 +1,55 @@
+#ifndef PONGPPMDISPLAY_H
+#define PONGPPMDISPLAY_H
+
+#include "FrameBufferDisplay.h"
+#include <stdio.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Framebuffer display that writes every frame shown to a stream
+ *    as a binary PPM (P6) image.
+ *    The frames are simply concatenated, which most image tools
+ *    (e.g. ffmpeg -f image2pipe, netpbm) read as a sequence.
+ */
+class PpmDisplay : public FrameBufferDisplay
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param stream The stream the frames are written to.
+   * @param width The width of the display in pixels.
+   * @param height The height of the display in pixels.
+   * @param scale How many image pixels wide (& high) each display pixel is.
+   */
+  PpmDisplay(FILE *stream, int16_t width, int16_t height, int scale = 1);
+
+  void show();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The stream the frames are written to.
+   */
+  FILE *stream;
+
+  /**
+   * @brief How many image pixels wide (& high) each display pixel is.
+   */
+  int scale;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGPPMDISPLAY_H
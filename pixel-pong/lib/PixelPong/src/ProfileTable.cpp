@@ -0,0 +1,228 @@
+#include "ProfileTable.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+// Called from the profiling interrupt, so kept out of flash
+#define PROFILE_IRAM IRAM_ATTR
+#else
+#define PROFILE_IRAM
+#endif
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ */
+ProfileTable::ProfileTable()
+{
+  clear();
+}
+
+/**
+ * @brief Record a sample.
+ *    The PC & task are hashed to a slot, then the slots after it are
+ *    probed for a match or an empty one.
+ * 
+ * @param pc The program counter sampled.
+ * @param task The task running, only compared @see platformCurrentTask
+ * @param taskName The name of the task, copied the first time it's seen.
+ */
+void PROFILE_IRAM ProfileTable::record(uint32_t pc, void *task, const char *taskName)
+{
+  int taskIndex = findTask(task, taskName);
+  sampleCount++;
+  taskSampleCounts[taskIndex]++;
+  uint32_t slot = ((pc ^ ((uint32_t)taskIndex << 24)) * 2654435761u) >> (32 - PROFILE_TABLE_BITS);
+  for (int probe = 0; probe < PROFILE_MAX_PROBES; probe++)
+  {
+    ProfileEntry &entry = entries[(slot + probe) & (PROFILE_TABLE_SIZE - 1)];
+    if (entry.samples == 0)
+    {
+      entry.pc = pc;
+      entry.task = taskIndex;
+    }
+    else if (entry.pc != pc || entry.task != taskIndex)
+    {
+      continue;
+    }
+    entry.samples++;
+    return;
+  }
+  droppedCount++;
+}
+
+/**
+ * @brief Discard every sample, tasks included.
+ */
+void ProfileTable::clear()
+{
+  memset(entries, 0, sizeof(entries));
+  memset(tasks, 0, sizeof(tasks));
+  memset(taskNames, 0, sizeof(taskNames));
+  memset(taskSampleCounts, 0, sizeof(taskSampleCounts));
+  taskCount = 0;
+  sampleCount = 0;
+  droppedCount = 0;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get a slot of the table, check its samples to see if it is used.
+ * 
+ * @param index 0 to PROFILE_TABLE_SIZE - 1.
+ */
+const ProfileEntry &ProfileTable::getEntry(int index)
+{
+  return entries[index];
+}
+
+/**
+ * @brief Get the number of samples recorded, dropped ones included.
+ */
+uint32_t ProfileTable::getSampleCount()
+{
+  return sampleCount;
+}
+
+/**
+ * @brief Get the number of samples dropped as the table was too full for their PC.
+ */
+uint32_t ProfileTable::getDroppedCount()
+{
+  return droppedCount;
+}
+
+/**
+ * @brief Get the number of tasks told apart.
+ */
+int ProfileTable::getTaskCount()
+{
+  return taskCount;
+}
+
+/**
+ * @brief Get the name of a task.
+ * 
+ * @param task The task, up to getTaskCount() - 1 or PROFILE_TASK_OTHER.
+ */
+const char *ProfileTable::getTaskName(int task)
+{
+  return task < taskCount ? taskNames[task] : "other";
+}
+
+/**
+ * @brief Get the number of samples taken in a task, dropped ones included.
+ * 
+ * @param task The task, up to getTaskCount() - 1 or PROFILE_TASK_OTHER.
+ */
+uint32_t ProfileTable::getTaskSampleCount(int task)
+{
+  return taskSampleCounts[task];
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+/**
+ * @brief Find a task, adding it if it hasn't been seen.
+ * 
+ * @param task The task.
+ * @param taskName The name of the task.
+ * 
+ * @return Its index, PROFILE_TASK_OTHER once there are too many.
+ */
+int PROFILE_IRAM ProfileTable::findTask(void *task, const char *taskName)
+{
+  for (int i = 0; i < taskCount; i++)
+  {
+    if (tasks[i] == task)
+    {
+      return i;
+    }
+  }
+  if (taskCount == PROFILE_MAX_TASKS)
+  {
+    return PROFILE_TASK_OTHER;
+  }
+  // Copied as the task may be deleted before the table is written out
+  tasks[taskCount] = task;
+  for (int i = 0; i < PROFILE_TASK_NAME_LENGTH - 1 && taskName != NULL && taskName[i] != '\0'; i++)
+  {
+    taskNames[taskCount][i] = taskName[i];
+  }
+  return taskCount++;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+const char *PROFILE_CSV_HEADER = "core,pc,task,samples";
+
+/**
+ * @brief Write a table out as lines of text: a "# profile core" summary,
+ *    a "# profile task" line per task (core, index, samples & name) and a
+ *    CSV row per PC & task (core,pc,task,samples), PCs in hex.
+ *    tools/symbolise_profile.py turns them into a report.
+ * 
+ * @param table The table, recording into it should be stopped.
+ * @param core The core it was sampled on.
+ * @param writeLine Called with each line (including its newline).
+ */
+void writeProfileTable(ProfileTable &table, int core, void (*writeLine)(const char *line))
+{
+  char line[64];
+  snprintf(line, sizeof(line), "# profile core %d samples=%lu dropped=%lu\n", core,
+           (unsigned long)table.getSampleCount(), (unsigned long)table.getDroppedCount());
+  writeLine(line);
+  for (int task = 0; task <= PROFILE_TASK_OTHER; task++)
+  {
+    if (task == table.getTaskCount())
+    {
+      task = PROFILE_TASK_OTHER;
+    }
+    if (table.getTaskSampleCount(task) == 0)
+    {
+      continue;
+    }
+    snprintf(line, sizeof(line), "# profile task %d %d %lu %s\n", core, task,
+             (unsigned long)table.getTaskSampleCount(task), table.getTaskName(task));
+    writeLine(line);
+  }
+  for (int i = 0; i < PROFILE_TABLE_SIZE; i++)
+  {
+    const ProfileEntry &entry = table.getEntry(i);
+    if (entry.samples == 0)
+    {
+      continue;
+    }
+    snprintf(line, sizeof(line), "%d,%08lx,%d,%lu\n", core, (unsigned long)entry.pc, entry.task, (unsigned long)entry.samples);
+    writeLine(line);
+  }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,193 @@
+#ifndef PONGPROFILETABLE_H
+#define PONGPROFILETABLE_H
+
+#include <stdint.h>
+
+/**
+ * @brief The table holds 2^PROFILE_TABLE_BITS distinct PC & task pairs.
+ */
+#define PROFILE_TABLE_BITS 9
+#define PROFILE_TABLE_SIZE (1 << PROFILE_TABLE_BITS)
+
+/**
+ * @brief Slots looked at for a PC before the sample is dropped.
+ */
+#define PROFILE_MAX_PROBES 16
+
+/**
+ * @brief The most tasks told apart, any more are counted as PROFILE_TASK_OTHER.
+ */
+#define PROFILE_MAX_TASKS 16
+#define PROFILE_TASK_OTHER PROFILE_MAX_TASKS
+#define PROFILE_TASK_NAME_LENGTH 16
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The number of samples taken at a PC in a task.
+ */
+struct ProfileEntry
+{
+  uint32_t pc;      /// The program counter sampled.
+  uint32_t samples; /// The number of times it was sampled, 0 for an empty slot.
+  uint8_t task;     /// The task it was running in @see ProfileTable::getTaskName
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Fixed size hash table of how often each PC (in each task) has
+ *    been sampled by a sampling profiler, along with how often each task
+ *    was. Recording is a hash & a few probes, never allocates & is safe
+ *    from an interrupt.
+ *    Recorded into by a single writer (e.g. one core's profiling
+ *    interrupt), only read once it has stopped.
+ */
+class ProfileTable
+{
+public:
+  /**
+   * @brief Class constructor.
+   */
+  ProfileTable();
+
+  /**
+   * @brief Record a sample.
+   * 
+   * @param pc The program counter sampled.
+   * @param task The task running, only compared @see platformCurrentTask
+   * @param taskName The name of the task, copied the first time it's seen.
+   */
+  void record(uint32_t pc, void *task, const char *taskName);
+
+  /**
+   * @brief Discard every sample, tasks included.
+   */
+  void clear();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get a slot of the table, check its samples to see if it is used.
+   * 
+   * @param index 0 to PROFILE_TABLE_SIZE - 1.
+   */
+  const ProfileEntry &getEntry(int index);
+
+  /**
+   * @brief Get the number of samples recorded, dropped ones included.
+   */
+  uint32_t getSampleCount();
+
+  /**
+   * @brief Get the number of samples dropped as the table was too full for their PC.
+   */
+  uint32_t getDroppedCount();
+
+  /**
+   * @brief Get the number of tasks told apart.
+   */
+  int getTaskCount();
+
+  /**
+   * @brief Get the name of a task.
+   * 
+   * @param task The task, up to getTaskCount() - 1 or PROFILE_TASK_OTHER.
+   */
+  const char *getTaskName(int task);
+
+  /**
+   * @brief Get the number of samples taken in a task, dropped ones included.
+   * 
+   * @param task The task, up to getTaskCount() - 1 or PROFILE_TASK_OTHER.
+   */
+  uint32_t getTaskSampleCount(int task);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The table, open addressed.
+   */
+  ProfileEntry entries[PROFILE_TABLE_SIZE];
+
+  /**
+   * @brief The tasks told apart, their names & how often each was sampled.
+   */
+  void *tasks[PROFILE_MAX_TASKS];
+  char taskNames[PROFILE_MAX_TASKS][PROFILE_TASK_NAME_LENGTH];
+  uint32_t taskSampleCounts[PROFILE_MAX_TASKS + 1];
+  int taskCount;
+
+  /**
+   * @brief The number of samples recorded & dropped.
+   */
+  uint32_t sampleCount;
+  uint32_t droppedCount;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Find a task, adding it if it hasn't been seen.
+   * 
+   * @param task The task.
+   * @param taskName The name of the task.
+   * 
+   * @return Its index, PROFILE_TASK_OTHER once there are too many.
+   */
+  int findTask(void *task, const char *taskName);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                               FUNCTIONS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Write a table out as lines of text: a "# profile core" summary,
+ *    a "# profile task" line per task (core, index, samples & name) and a
+ *    CSV row per PC & task (core,pc,task,samples), PCs in hex.
+ *    tools/symbolise_profile.py turns them into a report.
+ * 
+ * @param table The table, recording into it should be stopped.
+ * @param core The core it was sampled on.
+ * @param writeLine Called with each line (including its newline).
+ */
+void writeProfileTable(ProfileTable &table, int core, void (*writeLine)(const char *line));
+
+/**
+ * @brief The CSV header of the rows written by writeProfileTable.
+ */
+extern const char *PROFILE_CSV_HEADER;
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGPROFILETABLE_H
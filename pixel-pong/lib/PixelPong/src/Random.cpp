@@ -0,0 +1,91 @@
+#include "Random.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param seed The seed @see Random::seed
+ */
+Random::Random(uint32_t seed)
+{
+  this->seed(seed);
+}
+
+/**
+ * @brief Restart the sequence from a seed.
+ * 
+ * @param seed The seed, 0 is replaced by RANDOM_DEFAULT_SEED.
+ */
+void Random::seed(uint32_t seed)
+{
+  // xorshift only ever gives 0 from 0
+  this->state = seed != 0 ? seed : RANDOM_DEFAULT_SEED;
+}
+
+/**
+ * @brief Get the next number in the sequence (Marsaglia's xorshift32).
+ * 
+ * @return A number spread evenly over the full 32 bits.
+ */
+uint32_t Random::next()
+{
+  uint32_t x = this->state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  this->state = x;
+  return x;
+}
+
+/**
+ * @brief Get the next number in the sequence scaled to a range.
+ *    Scaled by multiplying rather than with %, which would lean on
+ *    the low bits (the weakest) and needs a divide.
+ * 
+ * @param bound The size of the range, must be positive.
+ * 
+ * @return A number from 0 to bound - 1.
+ */
+int Random::nextBelow(int bound)
+{
+  return (int)(((uint64_t)next() * (uint32_t)bound) >> 32);
+}
+
+/**
+ * @brief Select one of a fixed set of options.
+ * 
+ * @param options The options from which an element will be selected.
+ * @param count The number of options.
+ * 
+ * @return The selected element.
+ */
+int Random::pick(const int *options, int count)
+{
+  return options[nextBelow(count)];
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the current state, seeding another Random with it
+ *    carries on the same sequence.
+ */
+uint32_t Random::getState()
+{
+  return this->state;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
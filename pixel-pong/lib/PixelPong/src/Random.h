@@ -0,0 +1,92 @@
+#ifndef PONGRANDOM_H
+#define PONGRANDOM_H
+
+#include <stdint.h>
+
+/**
+ * @brief The seed used when none is given (or 0, which xorshift can't use).
+ */
+#define RANDOM_DEFAULT_SEED 0x9E3779B9u
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Small, fast, seedable pseudo random number generator (xorshift32).
+ *    Given the same seed it produces the same sequence on every platform,
+ *    so a game driven by it can be replayed exactly. Not for anything
+ *    that needs to be unpredictable.
+ */
+class Random
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param seed The seed @see Random::seed
+   */
+  Random(uint32_t seed = RANDOM_DEFAULT_SEED);
+
+  /**
+   * @brief Restart the sequence from a seed.
+   * 
+   * @param seed The seed, 0 is replaced by RANDOM_DEFAULT_SEED.
+   */
+  void seed(uint32_t seed);
+
+  /**
+   * @brief Get the next number in the sequence.
+   * 
+   * @return A number spread evenly over the full 32 bits.
+   */
+  uint32_t next();
+
+  /**
+   * @brief Get the next number in the sequence scaled to a range.
+   * 
+   * @param bound The size of the range, must be positive.
+   * 
+   * @return A number from 0 to bound - 1.
+   */
+  int nextBelow(int bound);
+
+  /**
+   * @brief Select one of a fixed set of options.
+   * 
+   * @param options The options from which an element will be selected.
+   * @param count The number of options.
+   * 
+   * @return The selected element.
+   */
+  int pick(const int *options, int count);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the current state, seeding another Random with it
+   *    carries on the same sequence.
+   */
+  uint32_t getState();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The current state, never 0.
+   */
+  uint32_t state;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGRANDOM_H
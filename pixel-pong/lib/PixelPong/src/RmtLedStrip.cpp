@@ -0,0 +1,208 @@
+#ifdef ARDUINO
+
+#include "RmtLedStrip.h"
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param pin The GPIO pin the strip's data line is connected to.
+ * @param channel The RMT channel to use.
+ * @param bytesPerPixel The number of colour bytes per pixel (3 for RGB, 4 for RGBW).
+ */
+RmtLedStrip::RmtLedStrip(uint8_t pin, rmt_channel_t channel, uint8_t bytesPerPixel)
+    : pin(pin),
+      channel(channel),
+      bytesPerPixel(bytesPerPixel),
+      front(0),
+      frontBytes(0),
+      transferCount(0),
+      skippedTransferCount(0),
+      waitCount(0),
+      bytesSent(0) {}
+
+/**
+ * @brief Set up the RMT channel.
+ * 
+ * @return Whether or not the channel could be set up.
+ */
+bool RmtLedStrip::begin()
+{
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, channel);
+  config.clk_div = RMT_LED_CLOCK_DIVIDER;
+  if (rmt_config(&config) != ESP_OK || rmt_driver_install(channel, 0, 0) != ESP_OK)
+  {
+    return false;
+  }
+  return rmt_translator_init(channel, translate) == ESP_OK;
+}
+
+/**
+ * @brief Start sending a frame, returns as soon as the transfer has
+ *    started. Only waits if the previous transfer (and its reset gap)
+ *    is still going.
+ *    Every transfer ends with the strip's reset, so once it is done the
+ *    frame has latched and the next can follow straight away.
+ * 
+ * @param pixels The colour bytes of the frame, in strip order.
+ * @param numPixels The number of pixels in the frame.
+ */
+void RmtLedStrip::show(const uint8_t *pixels, uint16_t numPixels)
+{
+  uint16_t numBytes = numPixels * bytesPerPixel;
+  if (numBytes > RMT_LED_MAX_BYTES)
+  {
+    numBytes = RMT_LED_MAX_BYTES - (RMT_LED_MAX_BYTES % bytesPerPixel);
+  }
+
+  // Find the last byte that differs from what the strip is showing (the front buffer)
+  uint16_t changedBytes = numBytes;
+  if (frontBytes == numBytes)
+  {
+    while (changedBytes > 0 && pixels[changedBytes - 1] == buffers[front][changedBytes - 1])
+    {
+      changedBytes--;
+    }
+  }
+  if (changedBytes == 0)
+  {
+    skippedTransferCount++;
+    return;
+  }
+  // Whole pixels only, the strip latches what it has been sent and the rest keep their colour
+  uint16_t sendBytes = ((changedBytes + bytesPerPixel - 1) / bytesPerPixel) * bytesPerPixel;
+
+  // The back buffer is free, the RMT only ever reads the front one
+  uint8_t back = front ^ 1;
+  memcpy(buffers[back], pixels, numBytes);
+
+  // Hand over once the previous transfer (which ends with the reset) is done
+  if (rmt_wait_tx_done(channel, 0) != ESP_OK)
+  {
+    waitCount++;
+    rmt_wait_tx_done(channel, pdMS_TO_TICKS(RMT_LED_WAIT_TIMEOUT_MS));
+  }
+  front = back;
+  frontBytes = numBytes;
+  rmt_write_sample(channel, buffers[front], sendBytes, false);
+  transferCount++;
+  bytesSent += sendBytes;
+}
+
+/**
+ * @brief Check whether a transfer is in progress.
+ */
+bool RmtLedStrip::isBusy()
+{
+  return rmt_wait_tx_done(channel, 0) != ESP_OK;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of transfers started.
+ */
+unsigned long RmtLedStrip::getTransferCount()
+{
+  return transferCount;
+}
+
+/**
+ * @brief Get the number of frames not sent as nothing had changed.
+ */
+unsigned long RmtLedStrip::getSkippedTransferCount()
+{
+  return skippedTransferCount;
+}
+
+/**
+ * @brief Get the number of times show() had to wait for the previous transfer.
+ */
+unsigned long RmtLedStrip::getWaitCount()
+{
+  return waitCount;
+}
+
+/**
+ * @brief Get the number of bytes sent to the strip.
+ */
+unsigned long RmtLedStrip::getBytesSent()
+{
+  return bytesSent;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+
+/**
+ * @brief RMT translator, converts colour bytes into RMT items (one per bit,
+ *    most significant first), then ends the frame with a low reset item.
+ *    Without it a frame started straight after another would run on from
+ *    it, and the strip would never latch either. Called from the RMT
+ *    interrupt as the transfer progresses, the last byte is held back
+ *    until there is room for the reset after it.
+ */
+void IRAM_ATTR RmtLedStrip::translate(const void *source, rmt_item32_t *destination, size_t sourceSize, size_t wantedItems, size_t *translatedSize, size_t *itemCount)
+{
+  if (source == NULL || destination == NULL)
+  {
+    *translatedSize = 0;
+    *itemCount = 0;
+    return;
+  }
+
+  rmt_item32_t zero;
+  zero.duration0 = RMT_LED_T0H;
+  zero.level0 = 1;
+  zero.duration1 = RMT_LED_T0L;
+  zero.level1 = 0;
+  rmt_item32_t one;
+  one.duration0 = RMT_LED_T1H;
+  one.level0 = 1;
+  one.duration1 = RMT_LED_T1L;
+  one.level1 = 0;
+  rmt_item32_t reset;
+  reset.duration0 = RMT_LED_RESET_HALF;
+  reset.level0 = 0;
+  reset.duration1 = RMT_LED_RESET_HALF;
+  reset.level1 = 0;
+
+  const uint8_t *bytes = (const uint8_t *)source;
+  size_t size = 0;
+  size_t count = 0;
+  while (size < sourceSize && count + 8 + (size + 1 == sourceSize ? 1 : 0) <= wantedItems)
+  {
+    for (int bit = 7; bit >= 0; bit--)
+    {
+      destination[count++].val = (bytes[size] & (1 << bit)) ? one.val : zero.val;
+    }
+    size++;
+    if (size == sourceSize)
+    {
+      destination[count++].val = reset.val;
+    }
+  }
+  *translatedSize = size;
+  *itemCount = count;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
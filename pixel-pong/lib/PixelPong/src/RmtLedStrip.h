@@ -0,0 +1,176 @@
+#ifndef PONGRMTLEDSTRIP_H
+#define PONGRMTLEDSTRIP_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <driver/rmt.h>
+#include "LedChannel.h"
+
+/**
+ * @brief The largest frame (in bytes) an RmtLedStrip can send.
+ */
+#ifndef RMT_LED_MAX_BYTES
+#define RMT_LED_MAX_BYTES 768
+#endif
+
+#define RMT_LED_CLOCK_DIVIDER 2 // 80MHz APB clock / 2, 25ns per RMT tick
+// WS2812 bit timings in RMT ticks
+#define RMT_LED_T0H 16 // 0.4us high for a 0
+#define RMT_LED_T0L 34 // 0.85us low for a 0
+#define RMT_LED_T1H 32 // 0.8us high for a 1
+#define RMT_LED_T1L 18 // 0.45us low for a 1
+#define RMT_LED_RESET_HALF 6400 // 2 x 160us low after each frame, WS2812s latch after >=280us
+#define RMT_LED_WAIT_TIMEOUT_MS 10 // The longest show() waits for the previous transfer
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Asynchronous, double buffered output to a WS2812 (NeoPixel) strip
+ *    using the RMT peripheral.
+ *    show() copies the frame into the back buffer and hands it to the RMT,
+ *    which clocks it out in the background (fed by the RMT interrupt)
+ *    while the CPU carries on with interrupts enabled. The buffers are
+ *    swapped each time a transfer is started.
+ *    Only the pixels up to the last one that changed are sent, the rest of
+ *    the strip keeps showing what it was last sent.
+ *    Each strip uses its own RMT channel, so several can be sent at once.
+ *    Only available when building for the device.
+ */
+class RmtLedStrip : public LedChannel
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param pin The GPIO pin the strip's data line is connected to.
+   * @param channel The RMT channel to use.
+   * @param bytesPerPixel The number of colour bytes per pixel (3 for RGB, 4 for RGBW).
+   */
+  RmtLedStrip(uint8_t pin, rmt_channel_t channel, uint8_t bytesPerPixel);
+
+  /**
+   * @brief Set up the RMT channel.
+   * 
+   * @return Whether or not the channel could be set up.
+   */
+  bool begin();
+
+  /**
+   * @brief Start sending a frame, returns as soon as the transfer has
+   *    started. Only waits if the previous transfer (and its reset gap)
+   *    is still going.
+   * 
+   * @param pixels The colour bytes of the frame, in strip order.
+   * @param numPixels The number of pixels in the frame.
+   */
+  void show(const uint8_t *pixels, uint16_t numPixels);
+
+  /**
+   * @brief Check whether a transfer is in progress.
+   */
+  bool isBusy();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of transfers started.
+   */
+  unsigned long getTransferCount();
+
+  /**
+   * @brief Get the number of frames not sent as nothing had changed.
+   */
+  unsigned long getSkippedTransferCount();
+
+  /**
+   * @brief Get the number of times show() had to wait for the previous transfer.
+   */
+  unsigned long getWaitCount();
+
+  /**
+   * @brief Get the number of bytes sent to the strip.
+   */
+  unsigned long getBytesSent();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The GPIO pin of the data line.
+   */
+  uint8_t pin;
+
+  /**
+   * @brief The RMT channel used.
+   */
+  rmt_channel_t channel;
+
+  /**
+   * @brief The number of colour bytes per pixel.
+   */
+  uint8_t bytesPerPixel;
+
+  /**
+   * @brief The front (being/last sent) and back buffers.
+   */
+  uint8_t buffers[2][RMT_LED_MAX_BYTES];
+
+  /**
+   * @brief Index of the front buffer.
+   */
+  uint8_t front;
+
+  /**
+   * @brief The number of bytes in the front buffer's frame, 0 before the first.
+   */
+  uint16_t frontBytes;
+
+  /**
+   * @brief The number of transfers started.
+   */
+  unsigned long transferCount;
+
+  /**
+   * @brief The number of frames not sent.
+   */
+  unsigned long skippedTransferCount;
+
+  /**
+   * @brief The number of times show() waited.
+   */
+  unsigned long waitCount;
+
+  /**
+   * @brief The number of bytes sent.
+   */
+  unsigned long bytesSent;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief RMT translator, converts colour bytes into RMT items (one per bit)
+   *    and ends the frame with the low reset the strip latches on.
+   *    Called from the RMT interrupt as the transfer progresses.
+   */
+  static void IRAM_ATTR translate(const void *source, rmt_item32_t *destination, size_t sourceSize, size_t wantedItems, size_t *translatedSize, size_t *itemCount);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
+
+#endif // PONGRMTLEDSTRIP_H
@@ -0,0 +1,144 @@
+#ifdef ARDUINO
+
+#include "SamplingProfiler.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param hz Samples taken per second on each core.
+ */
+SamplingProfiler::SamplingProfiler(uint32_t hz) : begun(), hz(hz) {}
+
+/**
+ * @brief Set up & start sampling the core it is called on. Call it from
+ *    a task on each core to be profiled, as an interrupt is handled on
+ *    the core it was allocated on.
+ * 
+ * @return Whether or not the timer & its interrupt could be set up.
+ */
+bool SamplingProfiler::begin()
+{
+  int core = xPortGetCoreID();
+  if (core >= PROFILE_CORES || begun[core])
+  {
+    return false;
+  }
+  timer_idx_t timer = (timer_idx_t)core;
+  timer_config_t config = {};
+  config.divider = PROFILE_TIMER_DIVIDER;
+  config.counter_dir = TIMER_COUNT_UP;
+  config.counter_en = TIMER_PAUSE;
+  config.alarm_en = TIMER_ALARM_EN;
+  config.auto_reload = TIMER_AUTORELOAD_EN;
+  if (timer_init(PROFILE_TIMER_GROUP, timer, &config) != ESP_OK ||
+      timer_set_counter_value(PROFILE_TIMER_GROUP, timer, 0) != ESP_OK ||
+      timer_set_alarm_value(PROFILE_TIMER_GROUP, timer, 1000000 / hz) != ESP_OK ||
+      timer_enable_intr(PROFILE_TIMER_GROUP, timer) != ESP_OK ||
+      timer_isr_register(PROFILE_TIMER_GROUP, timer, handleSample, this, ESP_INTR_FLAG_IRAM | ESP_INTR_FLAG_LEVEL3, NULL) != ESP_OK)
+  {
+    return false;
+  }
+  begun[core] = true;
+  return timer_start(PROFILE_TIMER_GROUP, timer) == ESP_OK;
+}
+
+/**
+ * @brief Start sampling again on every core begun.
+ */
+void SamplingProfiler::start()
+{
+  for (int core = 0; core < PROFILE_CORES; core++)
+  {
+    if (begun[core])
+    {
+      timer_start(PROFILE_TIMER_GROUP, (timer_idx_t)core);
+    }
+  }
+}
+
+/**
+ * @brief Stop sampling on every core begun. A sample being recorded is
+ *    finished within microseconds, so wait a moment before reading.
+ */
+void SamplingProfiler::stop()
+{
+  for (int core = 0; core < PROFILE_CORES; core++)
+  {
+    if (begun[core])
+    {
+      timer_pause(PROFILE_TIMER_GROUP, (timer_idx_t)core);
+    }
+  }
+}
+
+/**
+ * @brief Discard every sample, sampling should be stopped.
+ */
+void SamplingProfiler::clear()
+{
+  for (int core = 0; core < PROFILE_CORES; core++)
+  {
+    tables[core].clear();
+  }
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the samples taken on a core, sampling should be stopped.
+ * 
+ * @param core The core.
+ */
+ProfileTable &SamplingProfiler::getTable(int core)
+{
+  return tables[core];
+}
+
+/**
+ * @brief Get the number of samples taken per second on each core.
+ */
+uint32_t SamplingProfiler::getHz()
+{
+  return hz;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+/**
+ * @brief Timer interrupt handler, records the interrupted PC & task.
+ *    EPC3 still holds the interrupted PC, the window exceptions the
+ *    handler can take only use EPC1.
+ * 
+ * @param profiler The SamplingProfiler.
+ */
+void IRAM_ATTR SamplingProfiler::handleSample(void *profiler)
+{
+  uint32_t pc;
+  asm volatile("rsr %0, epc3" : "=r"(pc));
+  int core = xPortGetCoreID();
+  timer_group_clr_intr_status_in_isr(PROFILE_TIMER_GROUP, (timer_idx_t)core);
+  timer_group_enable_alarm_in_isr(PROFILE_TIMER_GROUP, (timer_idx_t)core);
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  ((SamplingProfiler *)profiler)->tables[core].record(pc, task, pcTaskGetTaskName(task));
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
@@ -0,0 +1,130 @@
+#ifndef PONGSAMPLINGPROFILER_H
+#define PONGSAMPLINGPROFILER_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <driver/timer.h>
+#include "ProfileTable.h"
+
+/**
+ * @brief Samples taken per second on each core. Just off 1kHz, so the
+ *    samples don't line up with the FreeRTOS tick & everything it wakes.
+ */
+#ifndef PROFILE_HZ
+#define PROFILE_HZ 997
+#endif
+
+#define PROFILE_CORES 2
+#define PROFILE_TIMER_GROUP TIMER_GROUP_1 // Timer 0 samples core 0, timer 1 core 1
+#define PROFILE_TIMER_DIVIDER 80          // 80MHz APB clock / 80, 1us per timer tick
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Statistical profiler for both cores.
+ *    A hardware timer per core interrupts it PROFILE_HZ times a second,
+ *    and the interrupt records the PC it interrupted & the task running
+ *    into that core's ProfileTable. The PC is read from EPC3, so the
+ *    interrupt is level 3 (the highest that can be handled in C); code
+ *    in critical sections (which mask up to level 3) is sampled as it
+ *    leaves them.
+ *    tools/symbolise_profile.py resolves the PCs against the firmware ELF
+ *    into per function, per task & per core utilisation.
+ *    Only available when building for the device.
+ */
+class SamplingProfiler
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param hz Samples taken per second on each core.
+   */
+  SamplingProfiler(uint32_t hz);
+
+  /**
+   * @brief Set up & start sampling the core it is called on. Call it from
+   *    a task on each core to be profiled, as an interrupt is handled on
+   *    the core it was allocated on.
+   * 
+   * @return Whether or not the timer & its interrupt could be set up.
+   */
+  bool begin();
+
+  /**
+   * @brief Start sampling again on every core begun.
+   */
+  void start();
+
+  /**
+   * @brief Stop sampling on every core begun. A sample being recorded is
+   *    finished within microseconds, so wait a moment before reading.
+   */
+  void stop();
+
+  /**
+   * @brief Discard every sample, sampling should be stopped.
+   */
+  void clear();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the samples taken on a core, sampling should be stopped.
+   * 
+   * @param core The core.
+   */
+  ProfileTable &getTable(int core);
+
+  /**
+   * @brief Get the number of samples taken per second on each core.
+   */
+  uint32_t getHz();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The samples taken on each core.
+   */
+  ProfileTable tables[PROFILE_CORES];
+
+  /**
+   * @brief Whether or not each core's timer has been set up.
+   */
+  bool begun[PROFILE_CORES];
+
+  /**
+   * @brief Samples taken per second on each core.
+   */
+  uint32_t hz;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Timer interrupt handler, records the interrupted PC & task.
+   * 
+   * @param profiler The SamplingProfiler.
+   */
+  static void IRAM_ATTR handleSample(void *profiler);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // ARDUINO
+
+#endif // PONGSAMPLINGPROFILER_H
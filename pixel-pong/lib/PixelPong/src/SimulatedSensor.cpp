@@ -0,0 +1,75 @@
+#include "SimulatedSensor.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param distance The initial distance in cm.
+ */
+SimulatedSensor::SimulatedSensor(int distance)
+    : distance(distance), echoLost(false), triggerCount(0) {}
+
+void SimulatedSensor::trigger()
+{
+  triggerCount++;
+}
+
+bool SimulatedSensor::getDistance(int &distance)
+{
+  if (echoLost)
+  {
+    return false;
+  }
+  distance = this->distance;
+  return true;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the number of times the sensor has been triggered.
+ */
+unsigned long SimulatedSensor::getTriggerCount()
+{
+  return triggerCount;
+}
+
+/**
+ * _____________ SETTERS
+ */
+
+/**
+ * @brief Set the distance the sensor will measure.
+ * 
+ * @param newDistance The distance in cm.
+ */
+void SimulatedSensor::setDistance(int newDistance)
+{
+  this->distance = newDistance;
+}
+
+/**
+ * @brief Set whether or not echoes are lost (no reading available).
+ * 
+ * @param newEchoLost Whether or not echoes are lost.
+ */
+void SimulatedSensor::setEchoLost(bool newEchoLost)
+{
+  this->echoLost = newEchoLost;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
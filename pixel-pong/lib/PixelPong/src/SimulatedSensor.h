@@ -0,0 +1,85 @@
+#ifndef PONGSIMULATEDSENSOR_H
+#define PONGSIMULATEDSENSOR_H
+
+#include "DistanceSensor.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Distance sensor whose readings are set by the program,
+ *    for running the paddle controls off-device.
+ *    Can simulate lost echoes, in which case the sensor reports
+ *    no reading, the same as an EchoSensor whose echo never returned.
+ */
+class SimulatedSensor : public DistanceSensor
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param distance The initial distance in cm.
+   */
+  SimulatedSensor(int distance = 0);
+
+  void trigger();
+
+  bool getDistance(int &distance);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of times the sensor has been triggered.
+   */
+  unsigned long getTriggerCount();
+
+  /**
+   * _____________ SETTERS
+   */
+
+  /**
+   * @brief Set the distance the sensor will measure.
+   * 
+   * @param newDistance The distance in cm.
+   */
+  void setDistance(int newDistance);
+
+  /**
+   * @brief Set whether or not echoes are lost (no reading available).
+   * 
+   * @param newEchoLost Whether or not echoes are lost.
+   */
+  void setEchoLost(bool newEchoLost);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The distance the sensor measures in cm.
+   */
+  int distance;
+
+  /**
+   * @brief Whether or not echoes are currently being lost.
+   */
+  bool echoLost;
+
+  /**
+   * @brief The number of times the sensor has been triggered.
+   */
+  unsigned long triggerCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGSIMULATEDSENSOR_H
@@ -0,0 +1,379 @@
+#include "Simulator.h"
+#include "Platform.h"
+#include "Log.h"
+#include <tuple>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param config The configuration of the simulated game.
+ * @param display The display to render onto (usually a NullDisplay).
+ */
+Simulator::Simulator(SimulationConfig config, Display &display)
+    : config(config),
+      display(display),
+      random(config.seed),
+      ball(config.ballPosition, config.ballVelocity),
+      paddle1(config.paddleSize, config.paddleAnchor, config.paddle1Position, config.hitRegions),
+      paddle2(config.paddleSize, config.paddleAnchor, config.paddle2Position, config.hitRegions),
+      board(config.boardX, config.boardY, ball, paddle1, paddle2),
+      pong(display, board, ball, paddle1, paddle2, random),
+      controller1(paddle1, sensor1, validPaddlePositions, config.controlHeightLower, config.controlHeightIncrement),
+      controller2(paddle2, sensor2, validPaddlePositions, config.controlHeightLower, config.controlHeightIncrement),
+      paddle1Script(TRACK),
+      paddle2Script(TRACK),
+      renderInterval(0),
+      inputLog(NULL),
+      handleLatency(NULL),
+      renderLatency(NULL),
+      tickCount(0),
+      gameCount(0),
+      collisionCount(0),
+      frameCount(0)
+{
+  validPaddlePositions = getValidPaddlePositions(board, paddle1);
+  reset();
+}
+
+/**
+ * @brief Set the scripts used to drive the paddles.
+ * 
+ * @param paddle1Script The script for paddle 1.
+ * @param paddle2Script The script for paddle 2.
+ * @param cycle The valid position indices to cycle through for CYCLE scripts.
+ */
+void Simulator::setScripts(PaddleScript paddle1Script, PaddleScript paddle2Script, const std::vector<int> &cycle)
+{
+  this->paddle1Script = paddle1Script;
+  this->paddle2Script = paddle2Script;
+  this->cycle = cycle;
+}
+
+/**
+ * @brief Set how often a frame is rendered.
+ * 
+ * @param renderInterval Render every renderInterval ticks, 0 to never render.
+ */
+void Simulator::setRenderInterval(unsigned long renderInterval)
+{
+  this->renderInterval = renderInterval;
+}
+
+/**
+ * @brief Start recording the simulation into an input log, from the
+ *    game's starting state.
+ * 
+ * @param inputLog The log, NULL to stop recording.
+ */
+void Simulator::setInputLog(InputLog *inputLog)
+{
+  this->inputLog = inputLog;
+  pong.setInputLog(inputLog);
+  if (inputLog == NULL)
+  {
+    return;
+  }
+  InputLogHeader header = {
+      config.boardX, config.boardY,
+      config.paddleSize, config.paddleAnchor,
+      config.hitRegions.topSize, config.hitRegions.middleSize, config.hitRegions.bottomSize,
+      random.getState()};
+  inputLog->begin(header);
+  reset();
+}
+
+/**
+ * @brief Time each PixelPong::handle() & render() into histograms.
+ * 
+ * @param handleLatency Where the cycles taken by handle() are recorded, NULL to not time it.
+ * @param renderLatency Where the cycles taken by render() are recorded, NULL to not time it.
+ */
+void Simulator::setLatencyHistograms(LatencyHistogram *handleLatency, LatencyHistogram *renderLatency)
+{
+  this->handleLatency = handleLatency;
+  this->renderLatency = renderLatency;
+}
+
+/**
+ * @brief Re-run a recorded input log through PixelPong::handle() as fast
+ *    as the CPU allows, checking the state hash recorded for every step.
+ *    The paddles are set from the log rather than the scripts. The
+ *    simulator should be configured to match the log's header.
+ * 
+ * @param data The log.
+ * @param size The size of the log in bytes.
+ * 
+ * @return Summary of the replay.
+ */
+ReplayResult Simulator::replay(const uint8_t *data, size_t size)
+{
+  ReplayResult result = {};
+  result.firstMismatchStep = -1;
+  InputLogReader reader(data, size);
+  InputLogHeader header;
+  result.valid = reader.readHeader(header);
+  if (!result.valid)
+  {
+    return result;
+  }
+  // Don't record the replay over the top of itself
+  InputLog *recording = inputLog;
+  setInputLog(NULL);
+  random.seed(header.seed);
+  unsigned long startMicros = platformMicros();
+
+  InputLogRecord record;
+  uint32_t stateHash = 0;
+  while (reader.next(record))
+  {
+    switch (record.type)
+    {
+    case INPUT_LOG_STEP:
+    {
+      paddle1.setPosition(Position(paddle1.getPosition().x, record.paddle1Y));
+      paddle2.setPosition(Position(paddle2.getPosition().x, record.paddle2Y));
+      bool ballInWinState = pong.handle();
+      result.games += ballInWinState;
+      stateHash = pong.getStateHash();
+      if ((stateHash & 0xFF) != record.stateHash)
+      {
+        result.mismatches++;
+        result.firstMismatchStep = result.firstMismatchStep < 0 ? (long)result.steps : result.firstMismatchStep;
+      }
+      result.steps++;
+      break;
+    }
+
+    case INPUT_LOG_EVENT:
+      result.events++;
+      if (record.event == INPUT_LOG_RESET)
+      {
+        reset();
+      }
+      break;
+
+    case INPUT_LOG_SPEED:
+      ball.setSpeed(record.speed);
+      break;
+
+    case INPUT_LOG_CHECKPOINT:
+      result.checkpoints++;
+      if (stateHash != record.stateHash)
+      {
+        result.mismatches++;
+        result.firstMismatchStep = result.firstMismatchStep < 0 ? (long)result.steps - 1 : result.firstMismatchStep;
+      }
+      break;
+    }
+    logDrain(LOG_BUFFER_SIZE);
+  }
+
+  result.elapsedMicros = platformMicros() - startMicros;
+  this->inputLog = recording;
+  pong.setInputLog(recording);
+  return result;
+}
+
+/**
+ * @brief Reset the game to its starting state.
+ *    Recorded (along with the ball's speed) when recording.
+ */
+void Simulator::reset()
+{
+  ball.setPosition(config.ballPosition);
+  ball.setVelocity(config.ballVelocity);
+  paddle1.setPosition(config.paddle1Position);
+  paddle2.setPosition(config.paddle2Position);
+  pong.setCollisionCount(0);
+  // Hold the controllers where the paddles start
+  sensor1.setDistance(controller1.getDistanceForIndex(config.paddle1Position.y - validPaddlePositions.positions[0]));
+  sensor2.setDistance(controller2.getDistanceForIndex(config.paddle2Position.y - validPaddlePositions.positions[0]));
+  if (inputLog != NULL)
+  {
+    inputLog->recordEvent(INPUT_LOG_RESET);
+    inputLog->recordSpeed(ball.getSpeed());
+  }
+}
+
+/**
+ * @brief Advance the simulation by one tick: apply the scripted paddle
+ *    inputs, handle the game and render if due.
+ *    The game is reset automatically after a win state.
+ * 
+ * @return Whether or not the tick ended in a win state.
+ */
+bool Simulator::tick()
+{
+  applyScript(controller1, sensor1, paddle1Script);
+  applyScript(controller2, sensor2, paddle2Script);
+  controller1.update();
+  controller2.update();
+  tickCount++;
+
+  uint32_t startCycles = handleLatency != NULL ? platformCycleCount() : 0;
+  bool ballInWinState = pong.handle();
+  if (handleLatency != NULL)
+  {
+    handleLatency->record(platformCycleCount() - startCycles);
+  }
+  // Stands in for the device's log task
+  logDrain(LOG_BUFFER_SIZE);
+
+  if (renderInterval != 0 && tickCount % renderInterval == 0)
+  {
+    startCycles = renderLatency != NULL ? platformCycleCount() : 0;
+    pong.render(std::make_tuple(255, 255, 255), std::make_tuple(255, 255, 255), std::make_tuple(255, 255, 255));
+    if (renderLatency != NULL)
+    {
+      renderLatency->record(platformCycleCount() - startCycles);
+    }
+    frameCount++;
+  }
+
+  if (ballInWinState)
+  {
+    gameCount++;
+    collisionCount += pong.getPaddleCollisionCount();
+    reset();
+  }
+  return ballInWinState;
+}
+
+/**
+ * @brief Run the simulation for a number of ticks.
+ * 
+ * @param ticks The number of ticks to run for.
+ * 
+ * @return Summary of the run.
+ */
+SimulationResult Simulator::run(unsigned long ticks)
+{
+  unsigned long startTicks = tickCount;
+  unsigned long startGames = gameCount;
+  unsigned long startCollisions = collisionCount + pong.getPaddleCollisionCount();
+  unsigned long startFrames = frameCount;
+  unsigned long startMicros = platformMicros();
+
+  for (unsigned long i = 0; i < ticks; i++)
+  {
+    tick();
+  }
+
+  SimulationResult result;
+  result.elapsedMicros = platformMicros() - startMicros;
+  result.ticks = tickCount - startTicks;
+  result.games = gameCount - startGames;
+  result.paddleCollisions = (collisionCount + pong.getPaddleCollisionCount()) - startCollisions;
+  result.frames = frameCount - startFrames;
+  return result;
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the game manager being simulated.
+ */
+PixelPong &Simulator::getGame()
+{
+  return pong;
+}
+
+/**
+ * @brief Get the simulated ball.
+ */
+Ball &Simulator::getBall()
+{
+  return ball;
+}
+
+/**
+ * @brief Get one of the simulated paddles.
+ * 
+ * @param index 1 or 2.
+ */
+Paddle &Simulator::getPaddle(int index)
+{
+  return index == 1 ? paddle1 : paddle2;
+}
+
+/**
+ * @brief Get the simulated board.
+ */
+Board &Simulator::getBoard()
+{
+  return board;
+}
+
+/**
+ * @brief Get the simulated sensor controlling one of the paddles.
+ * 
+ * @param index 1 or 2.
+ */
+SimulatedSensor &Simulator::getSensor(int index)
+{
+  return index == 1 ? sensor1 : sensor2;
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+/**
+ * @brief Set a paddle's simulated sensor according to its script.
+ * 
+ * @param controller The controller of the paddle.
+ * @param sensor The simulated sensor of the paddle.
+ * @param script The script driving the paddle.
+ */
+void Simulator::applyScript(PaddleController &controller, SimulatedSensor &sensor, PaddleScript script)
+{
+  int positionCount = validPaddlePositions.count;
+  int index = 0;
+
+  switch (script)
+  {
+  case HOLD:
+    return;
+
+  case TRACK:
+    // Follow the ball, clamped to the range the paddle can reach.
+    index = ball.getPosition().y - validPaddlePositions.positions[0];
+    break;
+
+  case SWEEP:
+  {
+    // Ping-pong between the lowest and highest valid position.
+    int period = positionCount > 1 ? 2 * (positionCount - 1) : 1;
+    index = tickCount % period;
+    index = index < positionCount ? index : period - index;
+    break;
+  }
+
+  case CYCLE:
+    if (cycle.empty())
+    {
+      return;
+    }
+    index = cycle[tickCount % cycle.size()];
+    break;
+  }
+  index = index < 0 ? 0 : (index >= positionCount ? positionCount - 1 : index);
+  sensor.setDistance(controller.getDistanceForIndex(index));
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
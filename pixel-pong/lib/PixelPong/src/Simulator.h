@@ -0,0 +1,311 @@
+#ifndef PONGSIMULATOR_H
+#define PONGSIMULATOR_H
+
+#include "Helpers.h"
+#include "Ball.h"
+#include "Paddle.h"
+#include "Board.h"
+#include "Display.h"
+#include "PixelPong.h"
+#include "PaddleController.h"
+#include "SimulatedSensor.h"
+#include "InputLog.h"
+#include "LatencyHistogram.h"
+#include <vector>
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS                                                      
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The configuration of a simulated game.
+ *    Mirrors the game variables & starting states in main.cpp.
+ */
+struct SimulationConfig
+{
+  int boardX;                /// Size of the game board X dimension in pixels.
+  int boardY;                /// Size of the game board Y dimension in pixels.
+  int paddleSize;            /// Size of the paddles in pixels.
+  int paddleAnchor;          /// The pixel used to specify the paddle anchor position @see Paddle::Paddle
+  HitRegions hitRegions;     /// The HitRegions for the paddles.
+  Position ballPosition;     /// The starting position of the ball.
+  Velocity ballVelocity;     /// The starting velocity of the ball.
+  Position paddle1Position;  /// The starting position of paddle 1.
+  Position paddle2Position;  /// The starting position of paddle 2.
+  int controlHeightLower;     /// cm below which a paddle is in the first position @see PaddleController
+  int controlHeightIncrement; /// cm covered by each subsequent paddle position @see PaddleController
+  uint32_t seed;              /// Seed for random rebounds, the same seed replays the same run.
+};
+
+/**
+ * @brief Scripts for driving a paddle in place of a player.
+ */
+enum PaddleScript
+{
+  HOLD,  /// The paddle never moves.
+  TRACK, /// The paddle follows the ball (a player that never misses).
+  SWEEP, /// The paddle sweeps up and down the valid positions, one step per tick.
+  CYCLE  /// The paddle cycles through a list of recorded valid position indices.
+};
+
+/**
+ * @brief Summary of a simulation run.
+ */
+struct SimulationResult
+{
+  unsigned long ticks;            /// Number of game ticks (PixelPong::handle calls) run.
+  unsigned long games;            /// Number of games that ended in a win state.
+  unsigned long paddleCollisions; /// Total number of ball to paddle collisions.
+  unsigned long frames;           /// Number of frames rendered.
+  unsigned long elapsedMicros;    /// Wall clock time taken.
+};
+
+/**
+ * @brief Summary of an input log replay.
+ */
+struct ReplayResult
+{
+  bool valid;                  /// Whether or not the log had a valid header.
+  unsigned long steps;         /// Number of steps (PixelPong::handle calls) replayed.
+  unsigned long games;         /// Number of games that ended in a win state.
+  unsigned long events;        /// Number of events replayed (resets included).
+  unsigned long checkpoints;   /// Number of full state hashes checked.
+  unsigned long mismatches;    /// Number of steps & checkpoints whose hash didn't match the recording.
+  long firstMismatchStep;      /// The step of the first mismatch, -1 if none.
+  unsigned long elapsedMicros; /// Wall clock time taken.
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Headless simulator for the game. Owns a full set of game entities
+ *    and drives PixelPong::handle() with scripted paddle inputs as fast as
+ *    the CPU allows, restarting the game each time it is won.
+ *    Scripts move the paddles through simulated sensors and the same
+ *    PaddleController used on the device.
+ */
+class Simulator
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param config The configuration of the simulated game.
+   * @param display The display to render onto (usually a NullDisplay).
+   */
+  Simulator(SimulationConfig config, Display &display);
+
+  /**
+   * @brief Set the scripts used to drive the paddles.
+   * 
+   * @param paddle1Script The script for paddle 1.
+   * @param paddle2Script The script for paddle 2.
+   * @param cycle The valid position indices to cycle through for CYCLE scripts.
+   *    @see PaddleScript
+   */
+  void setScripts(PaddleScript paddle1Script, PaddleScript paddle2Script, const std::vector<int> &cycle = std::vector<int>());
+
+  /**
+   * @brief Set how often a frame is rendered.
+   * 
+   * @param renderInterval Render every renderInterval ticks, 0 to never render.
+   */
+  void setRenderInterval(unsigned long renderInterval);
+
+  /**
+   * @brief Start recording the simulation into an input log, from the
+   *    game's starting state.
+   *    @see InputLog
+   * 
+   * @param inputLog The log, NULL to stop recording. Must outlive the simulator.
+   */
+  void setInputLog(InputLog *inputLog);
+
+  /**
+   * @brief Time each PixelPong::handle() & render() into histograms.
+   * 
+   * @param handleLatency Where the cycles taken by handle() are recorded, NULL to not time it.
+   * @param renderLatency Where the cycles taken by render() are recorded, NULL to not time it.
+   *    Both must outlive the simulator.
+   */
+  void setLatencyHistograms(LatencyHistogram *handleLatency, LatencyHistogram *renderLatency);
+
+  /**
+   * @brief Re-run a recorded input log through PixelPong::handle() as fast
+   *    as the CPU allows, checking the state hash recorded for every step.
+   *    The paddles are set from the log rather than the scripts. The
+   *    simulator should be configured to match the log's header.
+   * 
+   * @param data The log.
+   * @param size The size of the log in bytes.
+   * 
+   * @return Summary of the replay.
+   */
+  ReplayResult replay(const uint8_t *data, size_t size);
+
+  /**
+   * @brief Reset the game to its starting state.
+   */
+  void reset();
+
+  /**
+   * @brief Advance the simulation by one tick: apply the scripted paddle
+   *    inputs, handle the game and render if due.
+   *    The game is reset automatically after a win state.
+   * 
+   * @return Whether or not the tick ended in a win state.
+   */
+  bool tick();
+
+  /**
+   * @brief Run the simulation for a number of ticks.
+   * 
+   * @param ticks The number of ticks to run for.
+   * 
+   * @return Summary of the run.
+   */
+  SimulationResult run(unsigned long ticks);
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the game manager being simulated.
+   */
+  PixelPong &getGame();
+
+  /**
+   * @brief Get the simulated ball.
+   */
+  Ball &getBall();
+
+  /**
+   * @brief Get one of the simulated paddles.
+   * 
+   * @param index 1 or 2.
+   */
+  Paddle &getPaddle(int index);
+
+  /**
+   * @brief Get the simulated board.
+   */
+  Board &getBoard();
+
+  /**
+   * @brief Get the simulated sensor controlling one of the paddles.
+   * 
+   * @param index 1 or 2.
+   */
+  SimulatedSensor &getSensor(int index);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The configuration of the simulated game.
+   */
+  SimulationConfig config;
+
+  /**
+   * @brief The display to render onto.
+   */
+  Display &display;
+
+  /**
+   * @brief The generator for random rebounds, seeded once so a whole run
+   *    (not just each game) is repeatable.
+   */
+  Random random;
+
+  /**
+   * @brief The simulated game entities.
+   */
+  Ball ball;
+  Paddle paddle1;
+  Paddle paddle2;
+  Board board;
+  PixelPong pong;
+
+  /**
+   * @brief The valid Y positions of the paddles.
+   */
+  PaddlePositions validPaddlePositions;
+
+  /**
+   * @brief The simulated controls of each paddle.
+   */
+  SimulatedSensor sensor1;
+  SimulatedSensor sensor2;
+  PaddleController controller1;
+  PaddleController controller2;
+
+  /**
+   * @brief The scripts driving each of the paddles.
+   */
+  PaddleScript paddle1Script;
+  PaddleScript paddle2Script;
+
+  /**
+   * @brief The valid position indices used by CYCLE scripts.
+   *    Only ever read once set, so ticking does not allocate.
+   */
+  std::vector<int> cycle;
+
+  /**
+   * @brief Render every renderInterval ticks, 0 to never render.
+   */
+  unsigned long renderInterval;
+
+  /**
+   * @brief Where the simulation is recorded, NULL if it isn't.
+   */
+  InputLog *inputLog;
+
+  /**
+   * @brief Where the cycles taken by handle() & render() are recorded, NULL if they aren't.
+   */
+  LatencyHistogram *handleLatency;
+  LatencyHistogram *renderLatency;
+
+  /**
+   * @brief Running totals for the simulation.
+   */
+  unsigned long tickCount;
+  unsigned long gameCount;
+  unsigned long collisionCount;
+  unsigned long frameCount;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Set a paddle's simulated sensor according to its script.
+   * 
+   * @param controller The controller of the paddle.
+   * @param sensor The simulated sensor of the paddle.
+   * @param script The script driving the paddle.
+   */
+  void applyScript(PaddleController &controller, SimulatedSensor &sensor, PaddleScript script);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGSIMULATOR_H
@@ -0,0 +1,132 @@
+#ifndef PONGSPSCQUEUE_H
+#define PONGSPSCQUEUE_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief Always inlined into the caller, so from an interrupt handler
+ *    the push is in IRAM along with it rather than emitted in flash.
+ */
+#define SPSC_INLINE __attribute__((always_inline))
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Lock-free single producer, single consumer ring buffer.
+ *    Safe to push from one interrupt handler (or task) while another task
+ *    pops, without disabling interrupts. Never allocates, a push to a
+ *    full queue is dropped and counted rather than overwriting.
+ * 
+ * @tparam T The element type, copied in and out.
+ * @tparam Capacity The number of elements held, must be a power of two.
+ */
+template <typename T, uint32_t Capacity>
+class SpscQueue
+{
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+  /**
+   * @brief Class constructor, the queue starts empty.
+   */
+  SpscQueue() : head(0), tail(0), droppedCount(0) {}
+
+  /**
+   * @brief Add an element to the back of the queue. Producer side only.
+   * 
+   * @param element The element to add.
+   * 
+   * @return Whether or not there was room for the element.
+   */
+  SPSC_INLINE bool push(const T &element)
+  {
+    uint32_t currentTail = tail.load(std::memory_order_relaxed);
+    if (currentTail - head.load(std::memory_order_acquire) == Capacity)
+    {
+      droppedCount.store(droppedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    elements[currentTail & (Capacity - 1)] = element;
+    // Publish the element before the new tail
+    tail.store(currentTail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Take the element from the front of the queue. Consumer side only.
+   * 
+   * @param element Set to the element taken.
+   * 
+   * @return Whether or not there was an element to take.
+   */
+  SPSC_INLINE bool pop(T &element)
+  {
+    uint32_t currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead == tail.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    element = elements[currentHead & (Capacity - 1)];
+    // Only hand the slot back once it has been read
+    head.store(currentHead + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the number of elements waiting, a snapshot when
+   *    called concurrently with push/pop.
+   */
+  uint32_t getSize() const
+  {
+    return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Get the number of elements dropped because the queue was full.
+   */
+  uint32_t getDroppedCount() const
+  {
+    return droppedCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief Storage for the elements, indexed by the counters modulo Capacity.
+   */
+  T elements[Capacity];
+
+  /**
+   * @brief Count of elements popped, only written by the consumer.
+   */
+  std::atomic<uint32_t> head;
+
+  /**
+   * @brief Count of elements pushed, only written by the producer.
+   */
+  std::atomic<uint32_t> tail;
+
+  /**
+   * @brief Count of elements dropped, only written by the producer.
+   */
+  std::atomic<uint32_t> droppedCount;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGSPSCQUEUE_H
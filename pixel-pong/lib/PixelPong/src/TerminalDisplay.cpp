@@ -0,0 +1,48 @@
+#include "TerminalDisplay.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param stream The stream the frames are written to (usually stdout).
+ * @param width The width of the display in pixels.
+ * @param height The height of the display in pixels.
+ */
+TerminalDisplay::TerminalDisplay(FILE *stream, int16_t width, int16_t height)
+    : FrameBufferDisplay(width, height), stream(stream) {}
+
+/**
+ * @brief Draw the frame in the terminal.
+ *    Each pixel is two (background coloured) characters wide,
+ *    so it comes out roughly square.
+ */
+void TerminalDisplay::show()
+{
+  FrameBufferDisplay::show();
+  // Clear the terminal for the first frame, then just move the cursor to the top left
+  fputs(getShowCount() == 1 ? "\x1b[2J\x1b[H" : "\x1b[H", stream);
+  for (int16_t y = 0; y < height; y++)
+  {
+    for (int16_t x = 0; x < width; x++)
+    {
+      uint8_t r, g, b;
+      Display::colourComponents(frame[y * width + x], r, g, b);
+      fprintf(stream, "\x1b[48;2;%u;%u;%um  ", r, g, b);
+    }
+    fputs("\x1b[0m\n", stream);
+  }
+  fflush(stream);
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,49 @@
+#ifndef PONGTERMINALDISPLAY_H
+#define PONGTERMINALDISPLAY_H
+
+#include "FrameBufferDisplay.h"
+#include <stdio.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Framebuffer display that draws every frame shown in a terminal,
+ *    using ANSI (24-bit colour) escape codes.
+ *    The terminal is cleared for the first frame, each after is drawn
+ *    over the last from the top left.
+ */
+class TerminalDisplay : public FrameBufferDisplay
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param stream The stream the frames are written to (usually stdout).
+   * @param width The width of the display in pixels.
+   * @param height The height of the display in pixels.
+   */
+  TerminalDisplay(FILE *stream, int16_t width, int16_t height);
+
+  void show();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The stream the frames are written to.
+   */
+  FILE *stream;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGTERMINALDISPLAY_H
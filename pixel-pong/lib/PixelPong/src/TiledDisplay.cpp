@@ -0,0 +1,201 @@
+#include "TiledDisplay.h"
+#include "Trace.h"
+#include <string.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param channels The output channel of each tile, row by row from the top left.
+ * @param tilesX The number of tiles across the display.
+ * @param tilesY The number of tiles down the display.
+ * @param tileWidth The width of each tile in pixels.
+ * @param tileHeight The height of each tile in pixels.
+ * @param tileLayout How the LEDs of each tile are wired, TILE_* flags.
+ */
+TiledDisplay::TiledDisplay(LedChannel **channels, uint8_t tilesX, uint8_t tilesY, int16_t tileWidth, int16_t tileHeight, uint8_t tileLayout)
+    : tilesX(tilesX),
+      // Never overrun the buffers, any tiles beyond are dropped
+      tilesY(tilesX * tilesY > MAX_TILES ? MAX_TILES / tilesX : tilesY),
+      tileWidth(tileWidth),
+      tileHeight(tileHeight * tileWidth * tilesX * tilesY > MAX_FRAME_PIXELS ? MAX_FRAME_PIXELS / (tileWidth * tilesX * tilesY) : tileHeight),
+      tileLayout(tileLayout),
+      brightness(255),
+      tilePushCount(0)
+{
+  for (int i = 0; i < MAX_TILES; i++)
+  {
+    this->channels[i] = i < this->tilesX * this->tilesY ? channels[i] : NULL;
+    tileChanged[i] = true;
+  }
+  memset(frame, 0, sizeof(frame));
+  memset(pixels, 0, sizeof(pixels));
+}
+
+void TiledDisplay::clear()
+{
+  int tilePixels = tileWidth * tileHeight;
+  for (int tile = 0; tile < tilesX * tilesY; tile++)
+  {
+    uint16_t *tileFrame = frame + tile * tilePixels;
+    for (int i = 0; i < tilePixels && !tileChanged[tile]; i++)
+    {
+      tileChanged[tile] = tileFrame[i] != 0;
+    }
+    memset(tileFrame, 0, sizeof(uint16_t) * tilePixels);
+  }
+}
+
+void TiledDisplay::drawPixel(int16_t x, int16_t y, uint16_t colour)
+{
+  int index = pixelIndex(x, y);
+  if (index < 0 || frame[index] == colour)
+  {
+    return;
+  }
+  frame[index] = colour;
+  tileChanged[index / (tileWidth * tileHeight)] = true;
+}
+
+/**
+ * @brief Start sending every tile that has changed, each on its own channel.
+ */
+void TiledDisplay::show()
+{
+  TRACE_SCOPE(TRACE_LED_PUSH);
+  int tilePixels = tileWidth * tileHeight;
+  // Brightness scaling as Adafruit_NeoPixel, 255 leaves the colours as they are
+  uint16_t scale = (uint16_t)brightness + 1;
+  for (int tile = 0; tile < tilesX * tilesY; tile++)
+  {
+    if (!tileChanged[tile])
+    {
+      continue;
+    }
+    for (int i = tile * tilePixels; i < (tile + 1) * tilePixels; i++)
+    {
+      uint8_t r, g, b;
+      Display::ledComponents(frame[i], r, g, b);
+      uint8_t *pixel = pixels + i * TILE_BYTES_PER_PIXEL;
+      pixel[0] = (g * scale) >> 8;
+      pixel[1] = (r * scale) >> 8;
+      pixel[2] = (b * scale) >> 8;
+    }
+    // Only starts the transfer, so the tiles are all sent at the same time
+    channels[tile]->show(pixels + tile * tilePixels * TILE_BYTES_PER_PIXEL, tilePixels);
+    tileChanged[tile] = false;
+    tilePushCount++;
+  }
+}
+
+/**
+ * _____________ GETTERS
+ */
+
+/**
+ * @brief Get the width of the display in pixels.
+ */
+int16_t TiledDisplay::getWidth()
+{
+  return tilesX * tileWidth;
+}
+
+/**
+ * @brief Get the height of the display in pixels.
+ */
+int16_t TiledDisplay::getHeight()
+{
+  return tilesY * tileHeight;
+}
+
+/**
+ * @brief Get the number of tiles (output channels).
+ */
+uint8_t TiledDisplay::getTileCount()
+{
+  return tilesX * tilesY;
+}
+
+/**
+ * @brief Get the number of tile frames sent to the channels.
+ */
+unsigned long TiledDisplay::getTilePushCount()
+{
+  return tilePushCount;
+}
+
+/**
+ * _____________ SETTERS
+ */
+
+/**
+ * @brief Set the brightness of the LEDs, the whole display is
+ *    sent again on the next show().
+ * 
+ * @param brightness The brightness (0 - 255).
+ */
+void TiledDisplay::setBrightness(uint8_t brightness)
+{
+  this->brightness = brightness;
+  for (int tile = 0; tile < tilesX * tilesY; tile++)
+  {
+    tileChanged[tile] = true;
+  }
+}
+
+/**
+ * <                               PRIVATE
+ * ---------------------------------------
+*/
+
+/**
+ * @brief Find where a pixel is in the strip order.
+ *    Tiles are stored one after another, the pixels within a tile
+ *    follow its wiring (as Adafruit_NeoMatrix).
+ * 
+ * @param x The X-coordinate of the pixel.
+ * @param y The Y-coordinate of the pixel.
+ * 
+ * @return The index of the pixel, -1 if off the display.
+ */
+int TiledDisplay::pixelIndex(int16_t x, int16_t y)
+{
+  if (x < 0 || x >= tilesX * tileWidth || y < 0 || y >= tilesY * tileHeight)
+  {
+    return -1;
+  }
+  int tile = (y / tileHeight) * tilesX + x / tileWidth;
+  int tileX = x % tileWidth;
+  int tileY = y % tileHeight;
+  if (tileLayout & TILE_BOTTOM)
+  {
+    tileY = tileHeight - 1 - tileY;
+  }
+  if (tileLayout & TILE_RIGHT)
+  {
+    tileX = tileWidth - 1 - tileX;
+  }
+
+  // Lines are the rows or columns the LEDs are wired along
+  int line = (tileLayout & TILE_COLUMNS) ? tileX : tileY;
+  int offset = (tileLayout & TILE_COLUMNS) ? tileY : tileX;
+  int lineLength = (tileLayout & TILE_COLUMNS) ? tileHeight : tileWidth;
+  if ((tileLayout & TILE_ZIGZAG) && (line & 1))
+  {
+    offset = lineLength - 1 - offset;
+  }
+  return tile * tileWidth * tileHeight + line * lineLength + offset;
+}
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
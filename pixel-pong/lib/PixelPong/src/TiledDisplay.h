@@ -0,0 +1,183 @@
+#ifndef PONGTILEDDISPLAY_H
+#define PONGTILEDDISPLAY_H
+
+#include "Display.h"
+#include "LedChannel.h"
+
+/**
+ * @brief The most tiles (output channels) a TiledDisplay can drive,
+ *    the ESP32 has 8 RMT channels.
+ */
+#ifndef MAX_TILES
+#define MAX_TILES 8
+#endif
+
+#define TILE_BYTES_PER_PIXEL 3 // GRB, as WS2812 (NeoPixel) LEDs expect
+
+// How the LEDs of each tile are wired, same meaning as the NEO_MATRIX_* flags of Adafruit_NeoMatrix.
+// Combine one of each pair.
+#define TILE_TOP 0x00         // The first LED is on the top row
+#define TILE_BOTTOM 0x01      // The first LED is on the bottom row
+#define TILE_LEFT 0x00        // The first LED is in the left column
+#define TILE_RIGHT 0x02       // The first LED is in the right column
+#define TILE_ROWS 0x00        // LEDs are wired along rows
+#define TILE_COLUMNS 0x04     // LEDs are wired along columns
+#define TILE_PROGRESSIVE 0x00 // Every row (or column) runs the same direction
+#define TILE_ZIGZAG 0x08      // Rows (or columns) alternate direction
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display made up of a grid of equally sized LED panels (tiles),
+ *    each driven by its own output channel.
+ *    A large board can also be split into row groups (tiles the full
+ *    width of the board). On show() every tile that changed is started
+ *    on its channel before any has finished, so the refresh time depends
+ *    on the size of a tile rather than the whole board.
+ *    Colours are gamma expanded (as Adafruit_NeoMatrix), scaled by the
+ *    brightness and written out as GRB bytes.
+ */
+class TiledDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param channels The output channel of each tile, row by row from the top left.
+   *    There must be tilesX * tilesY (no more than MAX_TILES).
+   * @param tilesX The number of tiles across the display.
+   * @param tilesY The number of tiles down the display.
+   * @param tileWidth The width of each tile in pixels.
+   * @param tileHeight The height of each tile in pixels.
+   *    The whole display must be no more than MAX_FRAME_PIXELS.
+   * @param tileLayout How the LEDs of each tile are wired, TILE_* flags.
+   */
+  TiledDisplay(LedChannel **channels, uint8_t tilesX, uint8_t tilesY, int16_t tileWidth, int16_t tileHeight, uint8_t tileLayout);
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void show();
+
+  /**
+   * _____________ GETTERS
+   */
+
+  /**
+   * @brief Get the width of the display in pixels.
+   */
+  int16_t getWidth();
+
+  /**
+   * @brief Get the height of the display in pixels.
+   */
+  int16_t getHeight();
+
+  /**
+   * @brief Get the number of tiles (output channels).
+   */
+  uint8_t getTileCount();
+
+  /**
+   * @brief Get the number of tile frames sent to the channels.
+   */
+  unsigned long getTilePushCount();
+
+  /**
+   * _____________ SETTERS
+   */
+
+  /**
+   * @brief Set the brightness of the LEDs, the whole display is
+   *    sent again on the next show().
+   * 
+   * @param brightness The brightness (0 - 255).
+   */
+  void setBrightness(uint8_t brightness);
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The output channel of each tile.
+   */
+  LedChannel *channels[MAX_TILES];
+
+  /**
+   * @brief The number of tiles across the display.
+   */
+  uint8_t tilesX;
+
+  /**
+   * @brief The number of tiles down the display.
+   */
+  uint8_t tilesY;
+
+  /**
+   * @brief The width of each tile in pixels.
+   */
+  int16_t tileWidth;
+
+  /**
+   * @brief The height of each tile in pixels.
+   */
+  int16_t tileHeight;
+
+  /**
+   * @brief How the LEDs of each tile are wired.
+   */
+  uint8_t tileLayout;
+
+  /**
+   * @brief The brightness of the LEDs.
+   */
+  uint8_t brightness;
+
+  /**
+   * @brief The frame in strip order, tile after tile.
+   */
+  uint16_t frame[MAX_FRAME_PIXELS];
+
+  /**
+   * @brief The colour bytes sent to the channels, tile after tile.
+   */
+  uint8_t pixels[MAX_FRAME_PIXELS * TILE_BYTES_PER_PIXEL];
+
+  /**
+   * @brief Whether or not each tile has changed since it was last sent.
+   */
+  bool tileChanged[MAX_TILES];
+
+  /**
+   * @brief The number of tile frames sent to the channels.
+   */
+  unsigned long tilePushCount;
+
+  /**
+   * _____________ METHODS
+   */
+
+  /**
+   * @brief Find where a pixel is in the strip order.
+   * 
+   * @param x The X-coordinate of the pixel.
+   * @param y The Y-coordinate of the pixel.
+   * 
+   * @return The index of the pixel, -1 if off the display.
+   */
+  int pixelIndex(int16_t x, int16_t y);
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGTILEDDISPLAY_H
@@ -0,0 +1,46 @@
+#include "TimedDisplay.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * >                                PUBLIC
+ * ---------------------------------------
+*/
+/**
+ * @brief Class constructor.
+ * 
+ * @param target The display everything is passed through to.
+ * @param showLatency Where the time taken by each show() is recorded.
+ */
+TimedDisplay::TimedDisplay(Display &target, LatencyHistogram &showLatency)
+    : target(target), showLatency(showLatency) {}
+
+void TimedDisplay::clear()
+{
+  target.clear();
+}
+
+void TimedDisplay::drawPixel(int16_t x, int16_t y, uint16_t colour)
+{
+  target.drawPixel(x, y, colour);
+}
+
+void TimedDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour)
+{
+  target.fillRect(x, y, w, h, colour);
+}
+
+void TimedDisplay::show()
+{
+  LatencyTimer timer(showLatency);
+  target.show();
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
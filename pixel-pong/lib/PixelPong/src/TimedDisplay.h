@@ -0,0 +1,57 @@
+#ifndef PONGTIMEDDISPLAY_H
+#define PONGTIMEDDISPLAY_H
+
+#include "Display.h"
+#include "LatencyHistogram.h"
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Display that passes everything through to another, timing
+ *    each of its show() calls (the push out to the LEDs) into a histogram.
+ */
+class TimedDisplay : public Display
+{
+public:
+  /**
+   * @brief Class constructor.
+   * 
+   * @param target The display everything is passed through to.
+   * @param showLatency Where the time taken by each show() is recorded.
+   */
+  TimedDisplay(Display &target, LatencyHistogram &showLatency);
+
+  void clear();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t colour);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+
+  void show();
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The display everything is passed through to.
+   */
+  Display &target;
+
+  /**
+   * @brief Where the time taken by each show() is recorded.
+   */
+  LatencyHistogram &showLatency;
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGTIMEDDISPLAY_H
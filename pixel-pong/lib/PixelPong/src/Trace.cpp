@@ -0,0 +1,179 @@
+#include "Trace.h"
+#include "Platform.h"
+#include <atomic>
+#include <stdio.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+// Called from interrupts, so kept out of flash
+#define TRACE_IRAM IRAM_ATTR
+#else
+#define TRACE_IRAM
+#endif
+
+/**
+ * ==================================================================================================================
+ * ~                                                  TRACE                                                     
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+static_assert(TRACE_BUFFER_SIZE > 0 && (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0, "TRACE_BUFFER_SIZE must be a power of two");
+static_assert(sizeof(TraceEvent) == 8, "Trace events are written out as 8 bytes");
+static_assert(TRACE_LINE_BYTES % 8 == 0, "Trace lines must hold whole events");
+
+/**
+ * @brief The names of the trace points, written out with every dump.
+ */
+static const char *pointNames[] = {
+    "gameTask", "renderTask", "inputTask", "logTask", "mutexWait", "gameTimer", "renderTimer",
+    "buttonInterrupt", "echoInterrupt", "controllerUpdate", "handle", "render", "ledPush", "gameOver"};
+static_assert(sizeof(pointNames) / sizeof(pointNames[0]) == TRACE_POINT_COUNT, "Every trace point needs a name");
+
+/**
+ * @brief The ring buffer, always holding the latest events. Writers claim
+ *    a position and overwrite whatever was there, there is no reader while
+ *    recording so nothing needs to be handed back.
+ */
+static TraceEvent events[TRACE_BUFFER_SIZE];
+
+/**
+ * @brief Position of the next event to be written, claimed by writers.
+ */
+static std::atomic<uint32_t> writePosition(0);
+
+/**
+ * @brief Whether or not events are being recorded.
+ */
+static std::atomic<bool> enabled(false);
+
+/**
+ * @brief The task given each track (and its name), in the order they
+ *    first recorded an event. Never cleared, tasks live forever.
+ */
+static std::atomic<void *> trackTasks[TRACE_MAX_TRACKS];
+static const char *trackNames[TRACE_MAX_TRACKS];
+static std::atomic<int> trackCount(0);
+
+/**
+ * @brief Get the track of whatever is currently running, giving the task
+ *    a track of its own the first time it records an event.
+ * 
+ * @return The track, TRACE_TRACK_INTERRUPT in an interrupt.
+ */
+static uint8_t TRACE_IRAM currentTrack()
+{
+  if (platformInInterrupt())
+  {
+    return TRACE_TRACK_INTERRUPT;
+  }
+  void *task = platformCurrentTask();
+  int count = trackCount.load(std::memory_order_acquire);
+  count = count < TRACE_MAX_TRACKS ? count : TRACE_MAX_TRACKS;
+  for (int i = 0; i < count; i++)
+  {
+    if (trackTasks[i].load(std::memory_order_relaxed) == task)
+    {
+      return i;
+    }
+  }
+  if (count == TRACE_MAX_TRACKS)
+  {
+    return TRACE_TRACK_OTHER;
+  }
+  // Only this task looks for itself, so it can't be given two tracks
+  int track = trackCount.fetch_add(1, std::memory_order_relaxed);
+  if (track >= TRACE_MAX_TRACKS)
+  {
+    return TRACE_TRACK_OTHER;
+  }
+  trackNames[track] = platformCurrentTaskName();
+  trackTasks[track].store(task, std::memory_order_release);
+  return track;
+}
+
+void traceStart()
+{
+  enabled.store(false, std::memory_order_relaxed);
+  writePosition.store(0, std::memory_order_relaxed);
+  enabled.store(true, std::memory_order_release);
+}
+
+void traceStop()
+{
+  enabled.store(false, std::memory_order_release);
+}
+
+bool traceIsEnabled()
+{
+  return enabled.load(std::memory_order_relaxed);
+}
+
+void TRACE_IRAM traceWrite(uint8_t point, uint8_t phase)
+{
+  if (!enabled.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  TraceEvent event = {(uint32_t)platformMicros(), point, phase, currentTrack(), (uint8_t)platformCoreId()};
+  uint32_t position = writePosition.fetch_add(1, std::memory_order_relaxed);
+  events[position & (TRACE_BUFFER_SIZE - 1)] = event;
+}
+
+uint32_t traceDump(void (*writeLine)(const char *line))
+{
+  static const char hexDigits[] = "0123456789abcdef";
+  char line[TRACE_LINE_BYTES * 2 + 32];
+  uint32_t end = writePosition.load(std::memory_order_acquire);
+  uint32_t count = end < TRACE_BUFFER_SIZE ? end : TRACE_BUFFER_SIZE;
+  snprintf(line, sizeof(line), "# trace begin events=%lu lost=%lu\n", (unsigned long)count, (unsigned long)getTraceLostCount());
+  writeLine(line);
+  for (int i = 0; i < TRACE_POINT_COUNT; i++)
+  {
+    snprintf(line, sizeof(line), "# trace point %d %s\n", i, pointNames[i]);
+    writeLine(line);
+  }
+  int tracks = trackCount.load(std::memory_order_acquire);
+  tracks = tracks < TRACE_MAX_TRACKS ? tracks : TRACE_MAX_TRACKS;
+  for (int i = 0; i < tracks; i++)
+  {
+    const char *name = trackTasks[i].load(std::memory_order_acquire) != NULL ? trackNames[i] : NULL;
+    snprintf(line, sizeof(line), "# trace track %d %s\n", i, name != NULL ? name : "unnamed");
+    writeLine(line);
+  }
+
+  // Oldest first, TRACE_LINE_BYTES / 8 events per line
+  int lineLength = 0;
+  for (uint32_t position = end - count; position != end; position++)
+  {
+    const TraceEvent &event = events[position & (TRACE_BUFFER_SIZE - 1)];
+    uint8_t bytes[8] = {
+        (uint8_t)event.timestampMicros, (uint8_t)(event.timestampMicros >> 8),
+        (uint8_t)(event.timestampMicros >> 16), (uint8_t)(event.timestampMicros >> 24),
+        event.point, event.phase, event.track, event.core};
+    for (int i = 0; i < 8; i++)
+    {
+      line[lineLength++] = hexDigits[bytes[i] >> 4];
+      line[lineLength++] = hexDigits[bytes[i] & 0xF];
+    }
+    if (lineLength == TRACE_LINE_BYTES * 2 || position + 1 == end)
+    {
+      line[lineLength] = '\n';
+      line[lineLength + 1] = '\0';
+      writeLine(line);
+      lineLength = 0;
+    }
+  }
+  writeLine("# trace end\n");
+  return count;
+}
+
+uint32_t getTraceLostCount()
+{
+  uint32_t end = writePosition.load(std::memory_order_relaxed);
+  return end > TRACE_BUFFER_SIZE ? end - TRACE_BUFFER_SIZE : 0;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
@@ -0,0 +1,205 @@
+#ifndef PONGTRACE_H
+#define PONGTRACE_H
+
+#include <stdint.h>
+
+/**
+ * ==================================================================================================================
+ * ~                                                  TRACE                                                     
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Timeline tracing for the game.
+ *    The TRACE_* macros copy an 8 byte event (timestamp, trace point,
+ *    phase, task & core) into a lock-free ring buffer that always holds
+ *    the latest TRACE_BUFFER_SIZE events, overwriting the oldest. Safe
+ *    from any task or interrupt, on either core.
+ *    traceDump() writes the buffer out as lines of hex, which
+ *    tools/trace2chrome.py turns into Chrome trace JSON (for Perfetto or
+ *    chrome://tracing), one track per task per core.
+ *    Only compiled in with -DPONG_TRACE=1, and only recorded between
+ *    traceStart() & traceStop().
+ */
+
+/**
+ * @brief Whether or not the trace points are compiled in, set with -DPONG_TRACE=1.
+ */
+#ifndef PONG_TRACE
+#define PONG_TRACE 0
+#endif
+
+/**
+ * @brief The number of events held, must be a power of two.
+ *    ~700 events are recorded per second of play, so ~6 seconds.
+ */
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE 4096
+#endif
+
+/**
+ * @brief The most tasks given their own track, any more share TRACE_TRACK_OTHER.
+ */
+#define TRACE_MAX_TRACKS 16
+#define TRACE_TRACK_OTHER 0xFE
+#define TRACE_TRACK_INTERRUPT 0xFF
+
+/**
+ * @brief Bytes of trace written out per line of hex.
+ */
+#define TRACE_LINE_BYTES 32
+
+/**
+ * @brief Everything that can be traced. Add new points at the end so
+ *    older dumps still convert (the names are written out with every dump).
+ */
+enum TracePoint
+{
+  TRACE_GAME_TASK,         /// An iteration of the game task.
+  TRACE_RENDER_TASK,       /// An iteration of the render task.
+  TRACE_INPUT_TASK,        /// An iteration of the input task.
+  TRACE_LOG_TASK,          /// An iteration of the log task.
+  TRACE_MUTEX_WAIT,        /// Waiting for the game state mutex.
+  TRACE_GAME_TIMER,        /// The game tick timer callback.
+  TRACE_RENDER_TIMER,      /// The render timer callback.
+  TRACE_BUTTON_INTERRUPT,  /// A button interrupt.
+  TRACE_ECHO_INTERRUPT,    /// An ultrasonic sensor echo interrupt.
+  TRACE_CONTROLLER_UPDATE, /// Reading a sensor into its paddle's position.
+  TRACE_HANDLE,            /// PixelPong::handle(), one simulation step.
+  TRACE_RENDER,            /// PixelPong::render(), including the show.
+  TRACE_LED_PUSH,          /// Converting a frame & starting it on its way to the LEDs.
+  TRACE_GAME_OVER,         /// The game was won (an instant).
+  TRACE_POINT_COUNT
+};
+
+/**
+ * @brief The phase of an event, as the Chrome trace format's "ph".
+ */
+enum TracePhase
+{
+  TRACE_PHASE_BEGIN = 'B',
+  TRACE_PHASE_END = 'E',
+  TRACE_PHASE_INSTANT = 'i'
+};
+
+/**
+ * @brief A single event, as held in the ring buffer and written out
+ *    (little endian).
+ */
+struct TraceEvent
+{
+  uint32_t timestampMicros; /// When the event happened (platform micros).
+  uint8_t point;            /// The TracePoint.
+  uint8_t phase;            /// The TracePhase.
+  uint8_t track;            /// The task it happened on, or TRACE_TRACK_OTHER/INTERRUPT.
+  uint8_t core;             /// The core it happened on.
+};
+
+/**
+ * @brief Start recording, discarding anything already recorded.
+ */
+void traceStart();
+
+/**
+ * @brief Stop recording. Events already being written are finished
+ *    within microseconds, so wait a moment before traceDump().
+ */
+void traceStop();
+
+/**
+ * @brief Check whether events are being recorded.
+ */
+bool traceIsEnabled();
+
+/**
+ * @brief Record an event. Use the TRACE_* macros instead, so the call can
+ *    be compiled out.
+ * 
+ * @param point The TracePoint.
+ * @param phase The TracePhase.
+ */
+void traceWrite(uint8_t point, uint8_t phase);
+
+/**
+ * @brief Write the recorded events out, oldest first, as lines of hex
+ *    between "# trace begin" & "# trace end" markers, after the names of
+ *    the trace points and tracks. Recording should be stopped.
+ * 
+ * @param writeLine Called with each line (including its newline).
+ * 
+ * @return The number of events written.
+ */
+uint32_t traceDump(void (*writeLine)(const char *line));
+
+/**
+ * @brief Get the number of events overwritten since recording started.
+ */
+uint32_t getTraceLostCount();
+
+/**
+ * @brief Always inlined into the caller, so from an interrupt handler
+ *    the code is in IRAM along with it rather than called in flash.
+ */
+#define TRACE_INLINE __attribute__((always_inline))
+
+/**
+ * @brief Records the begin & end of the scope it is declared in.
+ *    Safe in interrupt handlers, its constructor & destructor are always
+ *    inlined (traceWrite itself is in IRAM).
+ */
+class TraceScope
+{
+public:
+  /**
+   * @brief Class constructor, records the begin.
+   * 
+   * @param point The TracePoint.
+   */
+  TRACE_INLINE TraceScope(uint8_t point) : point(point)
+  {
+    traceWrite(point, TRACE_PHASE_BEGIN);
+  }
+
+  /**
+   * @brief Class destructor, records the end.
+   */
+  TRACE_INLINE ~TraceScope()
+  {
+    traceWrite(point, TRACE_PHASE_END);
+  }
+
+private:
+  /**
+   * _____________ MEMEBER VARIABLES
+   */
+
+  /**
+   * @brief The TracePoint.
+   */
+  uint8_t point;
+};
+
+/**
+ * @brief Tracing macros.
+ *    e.g. { TRACE_SCOPE(TRACE_HANDLE); ... } or TRACE_INSTANT(TRACE_GAME_OVER);
+ */
+#if PONG_TRACE
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_BEGIN(point) traceWrite(point, TRACE_PHASE_BEGIN)
+#define TRACE_END(point) traceWrite(point, TRACE_PHASE_END)
+#define TRACE_INSTANT(point) traceWrite(point, TRACE_PHASE_INSTANT)
+#define TRACE_SCOPE(point) TraceScope TRACE_CONCAT(traceScope, __LINE__)(point)
+#else
+#define TRACE_BEGIN(point) ((void)0)
+#define TRACE_END(point) ((void)0)
+#define TRACE_INSTANT(point) ((void)0)
+#define TRACE_SCOPE(point) ((void)0)
+#endif
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGTRACE_H
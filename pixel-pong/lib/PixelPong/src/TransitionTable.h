@@ -0,0 +1,236 @@
+#ifndef PONGTRANSITIONTABLE_H
+#define PONGTRANSITIONTABLE_H
+
+#include "PixelPong.h"
+#include "GameGeometry.h"
+#include <stdint.h>
+
+/**
+ * @brief The number of outcomes stored per state, one for each
+ *    choice of random rebound (an index into {-1, 0, 1}).
+ */
+#define TRANSITION_CHOICES 3
+
+// Layout of an outcome
+#define TRANSITION_X_SHIFT 0       // Ball X + 1 (4 bits)
+#define TRANSITION_Y_SHIFT 4       // Ball Y (4 bits)
+#define TRANSITION_LEFT_SHIFT 8    // Set if the ball is moving left (1 bit)
+#define TRANSITION_VY_SHIFT 9      // Ball Y velocity + 1 (2 bits)
+#define TRANSITION_HITS_SHIFT 11   // Paddle collisions during the step (2 bits)
+#define TRANSITION_WIN_SHIFT 13    // Set if the ball left the board (1 bit)
+#define TRANSITION_RANDOM_SHIFT 14 // Set if the outcome depends on the random choice (1 bit)
+
+/**
+ * ==================================================================================================================
+ * ~                                               STRUCTS
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief The outcome of a single PixelPong::handle() step for every state
+ *    of a game moving one cell per step, whatever the size of the table.
+ *    A state is the ball's cell & direction and the paddles' positions,
+ *    paddle 1 in the left column and paddle 2 in the right.
+ *    @see TransitionTable
+ */
+struct TransitionTableView
+{
+  const uint16_t *outcomes; /// TRANSITION_CHOICES outcomes per state.
+  int stateCount;           /// The number of states.
+  int boardX;               /// Size of the board X dimension in pixels.
+  int boardY;               /// Size of the board Y dimension in pixels.
+  int paddleSize;           /// Size of the paddles in pixels.
+  int paddleAnchor;         /// The paddle anchor @see Paddle::Paddle
+  int paddlePositionCount;  /// The number of valid paddle positions.
+};
+
+/**
+ * @brief Find the index of a state.
+ * 
+ * @param boardY Size of the board Y dimension in pixels.
+ * @param paddlePositionCount The number of valid paddle positions.
+ * @param x The ball's X-coordinate.
+ * @param y The ball's Y-coordinate.
+ * @param vx The ball's X velocity (-1 or 1).
+ * @param vy The ball's Y velocity (-1, 0 or 1).
+ * @param paddle1 The index of paddle 1's position (0 is the lowest).
+ * @param paddle2 The index of paddle 2's position.
+ * 
+ * @return The index of the state.
+ */
+constexpr int transitionStateIndex(int boardY, int paddlePositionCount, int x, int y, int vx, int vy, int paddle1, int paddle2)
+{
+  return ((((x * boardY + y) * 2 + (vx < 0 ? 1 : 0)) * 3 + (vy + 1)) * paddlePositionCount + paddle1) * paddlePositionCount + paddle2;
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+/**
+ * ==================================================================================================================
+ * ~                                                  CLASS                                                    
+ * ------------------------------------------------------------------------------------------------------------------
+*/
+
+/**
+ * @brief Table of the outcome of PixelPong::handle() for every state of a
+ *    game moving one cell per step, generated at compile time.
+ *    The generator follows handle()'s rules for a ball starting on a whole
+ *    cell and moving one cell per step, where every contact happens at the
+ *    start of the step. Declared constexpr, the table is stored in flash.
+ *    It must be checked against handle() whenever the game rules change
+ *    (the simulator's --validate-table does so for every state).
+ * 
+ * @tparam BoardG The BoardGeometry of the game.
+ * @tparam PaddleG The PaddleGeometry of both paddles.
+ */
+template <class BoardG, class PaddleG>
+struct TransitionTable
+{
+  typedef GameGeometry<BoardG, PaddleG> Geometry;
+  static_assert(BoardG::xDim >= 4 && BoardG::xDim <= 14, "The ball's X-coordinate (-1 to xDim) must fit in 4 bits");
+  static_assert(BoardG::yDim <= 16, "The ball's Y-coordinate must fit in 4 bits");
+
+  static constexpr int boardX = BoardG::xDim;
+  static constexpr int boardY = BoardG::yDim;
+  static constexpr int paddlePositionCount = Geometry::paddlePositionCount;
+  static constexpr int stateCount = boardX * boardY * 2 * 3 * paddlePositionCount * paddlePositionCount;
+
+  /**
+   * @brief TRANSITION_CHOICES outcomes per state.
+   */
+  uint16_t outcomes[stateCount][TRANSITION_CHOICES];
+
+  /**
+   * @brief Get a view of the table, whatever its size.
+   */
+  TransitionTableView view() const
+  {
+    TransitionTableView tableView = {&outcomes[0][0], stateCount, boardX, boardY, PaddleG::size, PaddleG::anchor, paddlePositionCount};
+    return tableView;
+  }
+
+  /**
+   * @brief Generate the table.
+   */
+  static constexpr TransitionTable generate()
+  {
+    TransitionTable table = {};
+    for (int x = 0; x < boardX; x++)
+    {
+      for (int y = 0; y < boardY; y++)
+      {
+        for (int vx = -1; vx <= 1; vx += 2)
+        {
+          for (int vy = -1; vy <= 1; vy++)
+          {
+            for (int paddle1 = 0; paddle1 < paddlePositionCount; paddle1++)
+            {
+              for (int paddle2 = 0; paddle2 < paddlePositionCount; paddle2++)
+              {
+                int index = transitionStateIndex(boardY, paddlePositionCount, x, y, vx, vy, paddle1, paddle2);
+                for (int choice = 0; choice < TRANSITION_CHOICES; choice++)
+                {
+                  table.outcomes[index][choice] = step(x, y, vx, vy, paddle1 + Geometry::paddleYMin, paddle2 + Geometry::paddleYMin, choice);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    return table;
+  }
+
+private:
+  /**
+   * @brief Check whether the ball is about to enter a paddle's column on one
+   *    of its rows. As in Paddle::sweepPaddleCollision, judged half a pixel
+   *    on from the contact, including the half pixel above & below the paddle.
+   * 
+   * @return The row hit (clamped to the paddle) or -1 for no collision.
+   */
+  static constexpr int paddleRowHit(int x, int y, int vx, int vy, int paddleX, int paddleY)
+  {
+    int paddleYMax = paddleY + PaddleG::extentAbove;
+    int paddleYMin = paddleY - PaddleG::extentBelow;
+    if (!((vx < 0 && x == paddleX + 1) || (vx > 0 && x == paddleX - 1)))
+    {
+      return -1;
+    }
+    // Entry Y in half pixels
+    int entryY = 2 * y + vy;
+    if (entryY < 2 * paddleYMin - 1 || entryY > 2 * paddleYMax + 1)
+    {
+      return -1;
+    }
+    return y > paddleYMax ? paddleYMax : (y < paddleYMin ? paddleYMin : y);
+  }
+
+  /**
+   * @brief Follow PixelPong::handle() for one step.
+   * 
+   * @return The encoded outcome.
+   */
+  static constexpr uint16_t step(int x, int y, int vx, int vy, int paddle1Y, int paddle2Y, int choice)
+  {
+    int hits = 0;
+    bool random = false;
+    int collisions = 0;
+    for (; collisions < MAX_COLLISIONS_PER_TIMESTEP; collisions++)
+    {
+      // Paddles win ties, paddle 2 after paddle 1
+      bool boundaryHit = (vy > 0 && y + vy > boardY - 1) || (vy < 0 && y + vy < 0);
+      int paddleY = paddle2Y;
+      int rowHit = paddleRowHit(x, y, vx, vy, boardX - 1, paddle2Y);
+      if (rowHit < 0)
+      {
+        paddleY = paddle1Y;
+        rowHit = paddleRowHit(x, y, vx, vy, 0, paddle1Y);
+      }
+
+      if (!boundaryHit && rowHit < 0)
+      {
+        x += vx;
+        y += vy;
+        break;
+      }
+      if (rowHit < 0)
+      {
+        vy = -vy;
+        continue;
+      }
+
+      vx = -vx;
+      if (PaddleG::regionAt(rowHit - paddleY) != MIDDLE)
+      {
+        random = true;
+        vy = choice - 1;
+      }
+      hits++;
+      // On the top/bottom row the ball stays put for the rest of the step
+      if (y <= 0 || y >= boardY - 1)
+      {
+        break;
+      }
+    }
+
+    bool win = x < 0 || x > boardX - 1;
+    return (uint16_t)(((x + 1) << TRANSITION_X_SHIFT) |
+                      (y << TRANSITION_Y_SHIFT) |
+                      ((vx < 0 ? 1 : 0) << TRANSITION_LEFT_SHIFT) |
+                      ((vy + 1) << TRANSITION_VY_SHIFT) |
+                      ((hits > 3 ? 3 : hits) << TRANSITION_HITS_SHIFT) |
+                      ((win ? 1 : 0) << TRANSITION_WIN_SHIFT) |
+                      ((random ? 1 : 0) << TRANSITION_RANDOM_SHIFT));
+  }
+};
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------- 
+ * =================================================================================================================
+*/
+
+#endif // PONGTRANSITIONTABLE_H
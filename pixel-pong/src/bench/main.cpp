@@ -0,0 +1,358 @@
+#include <Benchmark.h>
+#include <Ball.h>
+#include <Board.h>
+#include <Paddle.h>
+#include <PixelPong.h>
+#include <NullDisplay.h>
+#include <FrameDiffDisplay.h>
+#include <FrameBufferDisplay.h>
+#include <BitBoard.h>
+#include <GameGeometry.h>
+#include <GameEvent.h>
+#include <SpscQueue.h>
+#include <Log.h>
+#include <Random.h>
+#include <InputLog.h>
+#include <LatencyHistogram.h>
+#include <DeadlineMonitor.h>
+#include <Trace.h>
+#include <ProfileTable.h>
+#include <Platform.h>
+#include <GameConfig.h>
+#include <ProjectThing.h>
+#include <stdio.h>
+#include <tuple>
+#include <vector>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+/**
+ * Benchmarks for the per-tick hot path (env:bench_native & env:bench_featheresp32).
+ * Results are logged as CSV (name,iterations,ns_per_op,cycles_per_op) so runs
+ * can be compared between commits with tools/compare_bench.py.
+ */
+
+/**
+ *       DEFINITIONS & DECLARATIONS
+ * ===============================
+ */
+// ====== DEFINITIONS
+#ifndef BENCH_DURATION_US
+#define BENCH_DURATION_US 200000 // Minimum time spent measuring each benchmark.
+#endif
+// Probe positions cover the board plus a one pixel border on every side.
+#define PROBE_X (GAME_BOARD_X + 2)
+#define PROBE_Y (GAME_BOARD_Y + 2)
+#define PROBE_COUNT (PROBE_X * PROBE_Y)
+#define BENCH_INPUT_LOG_SIZE 4096 // Restarted when full, so recording is measured rather than dropping records.
+
+// ====== DECLARATIONS
+//_______ Game Geometry
+typedef BoardGeometry<GAME_BOARD_X, GAME_BOARD_Y> GameBoard;
+typedef PaddleGeometry<GAME_PADDLE_SIZE, GAME_PADDLE_ANCHOR, GAME_PADDLE_HIT_REGIONS> GamePaddle;
+//_______ Game Elements
+NullDisplay display;
+Ball ball({INITIAL_BALL_POSITION}, {INITIAL_BALL_VELOCITY});
+Paddle paddle1(GamePaddle::size,
+               GamePaddle::anchor,
+               {INITIAL_PADDLE_POSITION1},
+               GamePaddle::regions());
+Paddle paddle2(GamePaddle::size,
+               GamePaddle::anchor,
+               {INITIAL_PADDLE_POSITION2},
+               GamePaddle::regions());
+Board board(GameBoard::xDim, GameBoard::yDim, ball, paddle1, paddle2);
+// Fixed seed, so every run measures the same sequence of rebounds
+Random gameRandom;
+PixelPong pong(display, board, ball, paddle1, paddle2, gameRandom);
+FrameDiffDisplay diffDisplay(display, GAME_BOARD_X, GAME_BOARD_Y);
+PixelPong diffPong(diffDisplay, board, ball, paddle1, paddle2, gameRandom);
+FrameBufferDisplay frameBufferDisplay(GAME_BOARD_X, GAME_BOARD_Y);
+PixelPong frameBufferPong(frameBufferDisplay, board, ball, paddle1, paddle2, gameRandom);
+SpscQueue<GameEvent, 16> events;
+uint8_t inputLogBuffer[BENCH_INPUT_LOG_SIZE];
+InputLog inputLog(inputLogBuffer, BENCH_INPUT_LOG_SIZE);
+LatencyHistogram latency;
+DeadlineMonitor deadline(20000);
+
+/**
+ * @brief Log a benchmark result as a CSV row.
+ * 
+ * @param result The result to log.
+ */
+void report(BenchmarkResult result)
+{
+  char row[96];
+  formatBenchmarkResult(result, row, sizeof(row));
+  platformLog(row);
+}
+
+/**
+ * @brief Reset the game to the starting state.
+ */
+void resetGame()
+{
+  ball.setPosition({INITIAL_BALL_POSITION});
+  ball.setVelocity({INITIAL_BALL_VELOCITY});
+  paddle1.setPosition({INITIAL_PADDLE_POSITION1});
+  paddle2.setPosition({INITIAL_PADDLE_POSITION2});
+  pong.setCollisionCount(0);
+}
+
+/**
+ * @brief Run every benchmark and log the results.
+ */
+void runBenchmarks()
+{
+  // Positions to probe collisions with, including those outside the board.
+  std::vector<Position> probes;
+  for (int i = 0; i < PROBE_COUNT; i++)
+  {
+    probes.push_back(Position((i % PROBE_X) - 1, (i / PROBE_X) - 1));
+  }
+  static const Velocity velocities[4] = {Velocity(-1, -1), Velocity(-1, 0), Velocity(1, 1), Velocity(1, 0)};
+
+#ifdef ARDUINO
+  platformLog("# pixelpong-bench platform=featheresp32");
+#else
+  platformLog("# pixelpong-bench platform=native");
+#endif
+  platformLog(BENCHMARK_CSV_HEADER);
+
+  // Logging the collisions would measure Serial/stdout, not the game.
+  platformSetLogEnabled(false);
+  logDrain(LOG_BUFFER_SIZE);
+
+  resetGame();
+  gameRandom.seed(RANDOM_DEFAULT_SEED);
+  BenchmarkResult handle = runBenchmark("pixelpong_handle", BENCH_DURATION_US, []() {
+    if (pong.handle())
+    {
+      resetGame();
+      return 1;
+    }
+    return 0;
+  });
+
+  resetGame();
+  gameRandom.seed(RANDOM_DEFAULT_SEED);
+  InputLogHeader inputLogHeader = {GameBoard::xDim, GameBoard::yDim, GamePaddle::size, GamePaddle::anchor, GAME_PADDLE_HIT_REGIONS, RANDOM_DEFAULT_SEED};
+  inputLog.begin(inputLogHeader);
+  pong.setInputLog(&inputLog);
+  BenchmarkResult handleRecorded = runBenchmark("pixelpong_handle_recorded", BENCH_DURATION_US, [&inputLogHeader]() {
+    if (inputLog.isTruncated())
+    {
+      inputLog.begin(inputLogHeader);
+    }
+    if (pong.handle())
+    {
+      resetGame();
+      return 1;
+    }
+    return 0;
+  });
+  pong.setInputLog(NULL);
+
+  uint32_t latencySample = 0;
+  BenchmarkResult latencyRecord = runBenchmark("latency_histogram_record", BENCH_DURATION_US, [&latencySample]() {
+    // Spread over the buckets (xorshift)
+    latencySample ^= latencySample << 13;
+    latencySample ^= latencySample >> 17;
+    latencySample ^= latencySample << 5;
+    latencySample += latencySample == 0;
+    latency.record(latencySample >> (latencySample & 31));
+    return 0;
+  });
+  BenchmarkResult latencyTimer = runBenchmark("latency_timer", BENCH_DURATION_US, []() {
+    LatencyTimer timer(latency);
+    return 0;
+  });
+  uint32_t firedMicros = 0;
+  BenchmarkResult deadlineServiced = runBenchmark("deadline_monitor_serviced", BENCH_DURATION_US, [&firedMicros]() {
+    // A tick every period, with a little jitter & lag
+    firedMicros += 20000 + (firedMicros & 0x3F);
+    deadline.serviced(firedMicros, firedMicros + (firedMicros & 0x1FF));
+    return 0;
+  });
+  // Called directly, so it's measured whether or not the trace points are compiled in
+  traceStart();
+  BenchmarkResult traceWriteResult = runBenchmark("trace_write", BENCH_DURATION_US, []() {
+    traceWrite(TRACE_HANDLE, TRACE_PHASE_BEGIN);
+    return 0;
+  });
+  traceStop();
+  // A few hundred hot PCs over two tasks, as the profiling interrupt sees them
+  static ProfileTable profileTable;
+  uint32_t sampleCount = 0;
+  int tasks[2];
+  BenchmarkResult profileRecord = runBenchmark("profile_table_record", BENCH_DURATION_US, [&sampleCount, &tasks]() {
+    sampleCount++;
+    profileTable.record(0x400D0000 + (sampleCount * 7919 % 256) * 4, &tasks[sampleCount & 1], "task");
+    return 0;
+  });
+
+  int probe = 0;
+  BenchmarkResult paddleCollision = runBenchmark("paddle_check_collision", BENCH_DURATION_US, [&probe, &probes]() {
+    probe = (probe + 1) % PROBE_COUNT;
+    return (int)paddle1.checkPaddleCollision(probes[probe]);
+  });
+
+  // Moving rebuilds the paddle's hit region lookup, the cost of keeping collision checks a single load.
+  int moveIndex = 0;
+  PaddlePositions validPositions = getValidPaddlePositions(board, paddle2);
+  BenchmarkResult paddleMove = runBenchmark("paddle_set_position", BENCH_DURATION_US, [&moveIndex, &validPositions]() {
+    moveIndex = (moveIndex + 1) % validPositions.count;
+    paddle2.setPosition(Position(GAME_BOARD_X - 1, validPositions.positions[moveIndex]));
+    return moveIndex;
+  });
+  paddle2.setPosition({INITIAL_PADDLE_POSITION2});
+
+  // The same check with the paddle's extents & regions folded in at compile time.
+  BenchmarkResult geometryCollision = runBenchmark("paddle_geometry_check_collision", BENCH_DURATION_US, [&probe, &probes]() {
+    probe = (probe + 1) % PROBE_COUNT;
+    return (int)GamePaddle::checkCollision(paddle1.getPosition(), probes[probe]);
+  });
+
+  // The same check as masks of each hit region, built once as they only change when the paddle moves.
+  BitBoard topMask(GAME_BOARD_X, GAME_BOARD_Y);
+  BitBoard middleMask(GAME_BOARD_X, GAME_BOARD_Y);
+  BitBoard bottomMask(GAME_BOARD_X, GAME_BOARD_Y);
+  paddle1.fillHitRegionMask(topMask, TOP);
+  paddle1.fillHitRegionMask(middleMask, MIDDLE);
+  paddle1.fillHitRegionMask(bottomMask, BOTTOM);
+  BenchmarkResult bitBoardCollision = runBenchmark("bitboard_check_collision", BENCH_DURATION_US, [&]() {
+    probe = (probe + 1) % PROBE_COUNT;
+    Position position = probes[probe];
+    if (topMask.test(position.x, position.y))
+    {
+      return (int)TOP;
+    }
+    if (middleMask.test(position.x, position.y))
+    {
+      return (int)MIDDLE;
+    }
+    return bottomMask.test(position.x, position.y) ? (int)BOTTOM : (int)NO_COLLISION;
+  });
+
+  BenchmarkResult boundaryCollision = runBenchmark("board_check_boundary_collision", BENCH_DURATION_US, [&probe, &probes]() {
+    probe = (probe + 1) % PROBE_COUNT;
+    return (int)board.checkBoundaryCollision(probes[probe]);
+  });
+
+  BenchmarkResult winState = runBenchmark("board_check_win_state", BENCH_DURATION_US, [&probe, &probes]() {
+    probe = (probe + 1) % PROBE_COUNT;
+    return (int)board.checkWinState(probes[probe]);
+  });
+
+  int velocity = 0;
+  BenchmarkResult reboundVertical = runBenchmark("rebound_velocity_vertical", BENCH_DURATION_US, [&velocity]() {
+    velocity = (velocity + 1) & 3;
+    return reboundVelocity(velocities[velocity], VERTICAL).y;
+  });
+
+  BenchmarkResult reboundVerticalRandom = runBenchmark("rebound_velocity_vertical_random", BENCH_DURATION_US, [&velocity]() {
+    velocity = (velocity + 1) & 3;
+    return reboundVelocity(velocities[velocity], VERTICAL, &gameRandom).y;
+  });
+
+  BenchmarkResult reboundHorizontalRandom = runBenchmark("rebound_velocity_horizontal_random", BENCH_DURATION_US, [&velocity]() {
+    velocity = (velocity + 1) & 3;
+    return reboundVelocity(velocities[velocity], HORIZONTAL, &gameRandom).x;
+  });
+
+  resetGame();
+  BenchmarkResult render = runBenchmark("pixelpong_render_null", BENCH_DURATION_US, []() {
+    pong.render(std::make_tuple(BALL_COLOUR_RGB), std::make_tuple(PADDLE1_COLOUR_RBG), std::make_tuple(PADDLE2_COLOUR_RGB));
+    return 0;
+  });
+
+  // Both paddles as one mask, expanded to pixels.
+  BenchmarkResult renderBitBoard = runBenchmark("bitboard_render_paddles", BENCH_DURATION_US, []() {
+    BitBoard mask(GAME_BOARD_X, GAME_BOARD_Y);
+    paddle1.fillMask(mask);
+    paddle2.fillMask(mask);
+    mask.render(display, Display::colour(PADDLE1_COLOUR_RBG));
+    return mask.count();
+  });
+
+  // Rendered into memory & hashed, the cost of a frame short of pushing it to the LEDs.
+  BenchmarkResult renderFrameBuffer = runBenchmark("pixelpong_render_framebuffer", BENCH_DURATION_US, []() {
+    frameBufferPong.render(std::make_tuple(BALL_COLOUR_RGB), std::make_tuple(PADDLE1_COLOUR_RBG), std::make_tuple(PADDLE2_COLOUR_RGB));
+    return (int)frameBufferDisplay.getFrameHash();
+  });
+
+  // The same (unchanged) frame each time, so every push after the first is skipped.
+  BenchmarkResult renderDiff = runBenchmark("pixelpong_render_diff_unchanged", BENCH_DURATION_US, []() {
+    diffPong.render(std::make_tuple(BALL_COLOUR_RGB), std::make_tuple(PADDLE1_COLOUR_RBG), std::make_tuple(PADDLE2_COLOUR_RGB));
+    return 0;
+  });
+
+  uint32_t eventCount = 0;
+  BenchmarkResult eventQueue = runBenchmark("spsc_queue_push_pop", BENCH_DURATION_US, [&eventCount]() {
+    GameEvent event = {GAME_TICK, eventCount++};
+    events.push(event);
+    events.pop(event);
+    return (int)event.timestampMicros;
+  });
+
+  // With the platform log disabled the drain discards without formatting.
+  BenchmarkResult logWriteResult = runBenchmark("log_write", BENCH_DURATION_US, [&eventCount]() {
+    bool written = LOG_INFO_VALUE("Benchmark", (int32_t)eventCount++);
+    logDrain(1);
+    return (int)written;
+  });
+
+  platformSetLogEnabled(true);
+
+  report(handle);
+  report(handleRecorded);
+  report(latencyRecord);
+  report(latencyTimer);
+  report(deadlineServiced);
+  report(traceWriteResult);
+  report(profileRecord);
+  report(paddleCollision);
+  report(geometryCollision);
+  report(paddleMove);
+  report(bitBoardCollision);
+  report(boundaryCollision);
+  report(winState);
+  report(reboundVertical);
+  report(reboundVerticalRandom);
+  report(reboundHorizontalRandom);
+  report(render);
+  report(renderFrameBuffer);
+  report(renderBitBoard);
+  report(renderDiff);
+  report(eventQueue);
+  report(logWriteResult);
+}
+
+#ifdef ARDUINO
+/**
+ *                            SETUP
+ * ===============================
+ */
+void setup()
+{
+  Serial.begin(115200);
+  // Give the monitor a chance to connect before the results are printed.
+  delay(2000);
+  runBenchmarks();
+}
+
+/**
+ *                            LOOP
+ * ===============================
+ */
+void loop()
+{
+  delay(1000);
+}
+#else
+int main()
+{
+  runBenchmarks();
+  return 0;
+}
+#endif
@@ -1,16 +1,32 @@
 #include <Arduino.h>
-#include <Wire.h>
-#include <SPI.h>
-#include <Adafruit_I2CDevice.h>
-#include <Adafruit_GFX.h>
-#include <Adafruit_NeoMatrix.h>
-#include <Adafruit_NeoPixel.h>
 #include <Ball.h>
 #include <Board.h>
 #include <Paddle.h>
+#include <GameGeometry.h>
 #include <PixelPong.h>
+#include <TiledDisplay.h>
+#include <RmtLedStrip.h>
+#include <FrameDiffDisplay.h>
+#include <EchoSensor.h>
+#include <PaddleController.h>
+#include <GameClock.h>
+#include <GameEvent.h>
+#include <SpscQueue.h>
+#include <Log.h>
+#include <Platform.h>
+#include <Random.h>
+#include <InputLog.h>
+#include <LatencyHistogram.h>
+#include <TimedDisplay.h>
+#include <DeadlineMonitor.h>
+#include <Trace.h>
+#include <MemoryMonitor.h>
+#include <SamplingProfiler.h>
 #include <ProjectThing.h>
+#include <GameConfig.h>
 #include <tuple>
+#include <math.h>
+#include <atomic>
 /**
  *       DEFINITIONS & DECLARATIONS
  * ===============================
@@ -28,88 +44,186 @@
 #define BRIGHTNESS_LOWER_BTN_PIN 17
 #define BRIGHTNESS_RAISE_BTN_PIN 16
 //_______ LED Matrix
-#define LED_MATRIX_PIN 13
-#define NUM_PIXELS 64     // Total number of pixels in the entire matrix
+// The board is made up of LED_TILES_X by LED_TILES_Y panels (or row groups), each on its own data pin & RMT channel
+// so they're all refreshed at once. e.g. 4x 16x16 panels (2 by 2) or a 64x32 board as 8 row groups of 64x4 (1 by 8).
+#define LED_TILES_X 1
+#define LED_TILES_Y 1
+#define LED_TILE_LAYOUT (TILE_BOTTOM + TILE_RIGHT + TILE_COLUMNS + TILE_ZIGZAG) // How each panel is wired
+#define LED_MATRIX_PIN 13 // Data pin of the first panel
+#define LED_BYTES_PER_PIXEL 3 // GRB
+#define LED_RMT_CHANNEL RMT_CHANNEL_0
 #define MIN_BRIGHTNESS 10 // Seems to not come back on if it goes to 0
 #define MAX_BRIGHTNESS 250
 #define DEFAULT_BRIGHTNESS 25
 #define BRIGHTNESS_STEP 15 // Works best when using this value to configure the others to avoid going out of range.
 //_______ Game Speed Logic
-#define INITIAL_STATE_UPDATE_DELAY 1000        // ms delay between each game state update, mainly governs ball speed
-#define MIN_STATE_UPDATE_DELAY 100             // The mimimum allowed ms delay, should not be less than the render delay.
-#define STATE_UPDATE_DELAY_REDUCTION_FACTOR 50 // How much the delay is reduced by per ball to paddle collision.
-#define RENDER_DELAY 50                        // ms delay between rerendering the scene
-//_______ Game Variables
-// Board size only seems to work if the dimensions are equal to the number of x and y pixels on the new matrix
-#define GAME_BOARD_X 8                  // Size of the game board x dimension in pixels
-#define GAME_BOARD_Y 8                  // Size of the game board y dimension in pixels
-#define GAME_PADDLE_SIZE 3              // Size of the paddles in pixels
-#define GAME_PADDLE_ANCHOR 1            // The pixel that is used to specify anchor positon @see Paddle::Paddle
-#define GAME_PADDLE_HIT_REGIONS 1, 1, 1 // The HitRegions for the paddles @see Paddle::HitRegions
-//_______ Game Starting States
-#define INITIAL_BALL_POSITION 4, 2
-#define INITIAL_BALL_VELOCITY -1, 0
-#define INITIAL_PADDLE_POSITION1 0, 3
-#define INITIAL_PADDLE_POSITION2 7, 3
-//_______ Game Controls
-#define CONTROL_HEIGHT_LOWER 5     // cm for which any lower value will be classed as the lower state.
-#define CONTROL_HEIGHT_INCREMENT 5 // cm value indicated the size of the region corresponding to each paddle position.                            \
-                                   // i.e if Ultrasonic sensor height < CONTROL_HEIGHT_LOWER paddle will be in the first state                    \
-                                   //     if CONTROL_HEIGHT_LOWER <= Ultrasonic sensor height < CONTROL_HEIGHT_LOWER + n*CONTROL_HEIGHT_INCREMENT \
-                                   //     paddle will be in state n.
+#define GAME_TICK_DELAY 20              // ms per game state update (fixed simulation step), ball speed is a physics parameter
+#define MAX_GAME_STEPS_PER_UPDATE 5      // The most simulation steps caught up on at once, the rest are dropped
+#define INITIAL_STATE_UPDATE_DELAY 1000 // ms the ball initially takes to move one pixel, mainly governs ball speed
+#define MIN_STATE_UPDATE_DELAY 100      // The mimimum allowed ms per pixel, should not be less than the render delay or pixels get skipped on screen.
+#define SPEED_CURVE_COLLISIONS 8        // Ball to paddle collisions over which the ms per pixel falls ~63% of the way to the minimum.
+#define RENDER_DELAY 50                 // ms delay between sampling the controllers & rerendering the scene
+//_______ Tasks
+// The game & LED output share core 1 (LED output takes priority), the controllers & their interrupts get core 0.
+#define GAME_TASK_CORE 1
+#define GAME_TASK_PRIORITY 2
+#define RENDER_TASK_CORE 1
+#define RENDER_TASK_PRIORITY 3
+#define INPUT_TASK_CORE 0
+#define INPUT_TASK_PRIORITY 2
+#define LOG_TASK_CORE 0
+#define LOG_TASK_PRIORITY 1 // Below everything else, Serial output can wait
+#define LOG_DRAIN_DELAY 100 // ms between writing out buffered log records
+#define TASK_STACK_SIZE 4096
+#define EVENT_QUEUE_SIZE 16 // Events held per queue before new ones are dropped (power of two)
+//_______ Input Log
+// Each game is recorded (paddles, buttons & ball speed) so it can be replayed on the simulator.
+// Two logs are kept so one can be written out over Serial while the next game is recorded.
+#define INPUT_LOG_BUFFER_SIZE 16384 // Bytes per log, ~3 bytes per game tick so ~100 seconds of play
+#define INPUT_LOG_LINE_BYTES 32     // Bytes of log per line of hex written out
+//_______ Instrumentation
+// The time taken by each stage of a frame is kept in a histogram, and how late each timer event is serviced.
+// Reported over Serial (send 'l' or 'd', or every REPORT_DELAY)
+#define REPORT_DELAY 60000 // ms between latency & deadline reports, 0 to only report when asked
+// The last few seconds of tasks, timers, interrupts & game methods are traced (built with -DPONG_TRACE=1).
+// Written out over Serial when asked (send 't'), tools/trace2chrome.py turns a capture into a timeline.
+// Free heap, fragmentation, allocations & task stack high-water marks are sampled into a history (send 'm').
+#define MEMORY_SAMPLE_DELAY 60000 // ms between memory samples, MEMORY_SAMPLE_COUNT are kept (~an hour)
+// Both cores are sampled PROFILE_HZ times a second, the PCs & tasks seen are written out when asked (send 'p').
+// tools/symbolise_profile.py resolves a capture against the firmware ELF.
+#define PROFILE_MAX_RUNTIME_TASKS 24 // Tasks reported from the FreeRTOS run time stats, when they're enabled
 
 // ====== DECLARATIONS
 
+//_______ Game Geometry
+// Checked at compile time, a board or paddle that can't work fails to build
+typedef BoardGeometry<GAME_BOARD_X, GAME_BOARD_Y> GameBoard;
+typedef PaddleGeometry<GAME_PADDLE_SIZE, GAME_PADDLE_ANCHOR, GAME_PADDLE_HIT_REGIONS> GamePaddle;
+typedef GameGeometry<GameBoard, GamePaddle> Game;
+static_assert(GameBoard::xDim % LED_TILES_X == 0 && GameBoard::yDim % LED_TILES_Y == 0, "The LED panels must divide the board evenly");
+static_assert((GameBoard::xDim / LED_TILES_X) * (GameBoard::yDim / LED_TILES_Y) * LED_BYTES_PER_PIXEL <= RMT_LED_MAX_BYTES,
+              "Each LED panel must fit in an RmtLedStrip, use more tiles or raise RMT_LED_MAX_BYTES");
+static_assert(Game::isValidPaddlePosition(INITIAL_PADDLE_POSITION1) && Game::isValidPaddlePosition(INITIAL_PADDLE_POSITION2),
+              "The paddles must start on the board");
+static_assert(GameBoard::xDim <= 255 && GameBoard::yDim <= INPUT_LOG_MAX_Y + 1, "The board must fit in an input log");
+
+//_______ Instrumentation
+// The stages of a frame that are timed, each into its own histogram
+enum FrameStage
+{
+  STAGE_CONTROLLER1, // paddle1Controller.update()
+  STAGE_CONTROLLER2, // paddle2Controller.update()
+  STAGE_HANDLE,      // pong.handle(), per simulation step
+  STAGE_RENDER,      // pong.render(), including the show
+  STAGE_SHOW,        // Pushing a frame out to the LED matrix
+  STAGE_COUNT
+};
+const char *stageNames[STAGE_COUNT] = {"controller1", "controller2", "handle", "render", "show"};
+LatencyHistogram stageLatency[STAGE_COUNT]; // Only accessed holding gameStateMutex
+// How promptly each timer's events are serviced, only accessed holding gameStateMutex
+DeadlineMonitor gameTimerDeadline(GAME_TICK_DELAY * 1000);
+DeadlineMonitor renderTimerDeadline(RENDER_DELAY * 1000);
+MemoryMonitor memoryMonitor; // Only accessed by the log task
+SamplingProfiler profiler(PROFILE_HZ); // Only read by the log task
+
 //_______ Game Elements
+// Push frames out to each panel in the background, one strip per panel (add more for more tiles)
+RmtLedStrip ledStrip(LED_MATRIX_PIN, LED_RMT_CHANNEL, LED_BYTES_PER_PIXEL);
+LedChannel *ledChannels[] = {&ledStrip};
+static_assert(sizeof(ledChannels) / sizeof(ledChannels[0]) == LED_TILES_X * LED_TILES_Y, "There must be an LED strip for every tile");
 // The pixel matrix
-Adafruit_NeoMatrix pixelMatrix(GAME_BOARD_X, GAME_BOARD_Y, LED_MATRIX_PIN,
-                               NEO_MATRIX_BOTTOM + NEO_MATRIX_RIGHT + NEO_MATRIX_COLUMNS + NEO_MATRIX_ZIGZAG,
-                               NEO_GRB + NEO_KHZ800);
+TiledDisplay matrixDisplay(ledChannels, LED_TILES_X, LED_TILES_Y, GAME_BOARD_X / LED_TILES_X, GAME_BOARD_Y / LED_TILES_Y, LED_TILE_LAYOUT);
+// Times every push out to the pixel matrix
+TimedDisplay timedMatrixDisplay(matrixDisplay, stageLatency[STAGE_SHOW]);
+// The display the game renders onto (wraps the pixel matrix), only pushes frames that changed
+FrameDiffDisplay display(timedMatrixDisplay, GAME_BOARD_X, GAME_BOARD_Y);
 // Ball
 Ball ball({INITIAL_BALL_POSITION}, {INITIAL_BALL_VELOCITY});
 // Paddles
-Paddle paddle1(GAME_PADDLE_SIZE,
-               GAME_PADDLE_ANCHOR,
+Paddle paddle1(GamePaddle::size,
+               GamePaddle::anchor,
                {INITIAL_PADDLE_POSITION1},
-               {GAME_PADDLE_HIT_REGIONS});
-Paddle paddle2(GAME_PADDLE_SIZE,
-               GAME_PADDLE_ANCHOR,
+               GamePaddle::regions());
+Paddle paddle2(GamePaddle::size,
+               GamePaddle::anchor,
                {INITIAL_PADDLE_POSITION2},
-               {GAME_PADDLE_HIT_REGIONS});
+               GamePaddle::regions());
 // Board
-Board board(GAME_BOARD_X, GAME_BOARD_Y, ball, paddle1, paddle2);
+Board board(GameBoard::xDim, GameBoard::yDim, ball, paddle1, paddle2);
+// Valid paddle positions (paddles are intended to be the same), built at compile time & kept in flash
+constexpr PaddlePositions validPaddlePositions = Game::validPaddlePositions();
+// Controllers (ultrasonic sensors measured in the background)
+EchoSensor sensor1(TRIGGER_PIN1, ECHO_PIN1);
+EchoSensor sensor2(TRIGGER_PIN2, ECHO_PIN2);
+PaddleController paddle1Controller(paddle1, sensor1, validPaddlePositions, CONTROL_HEIGHT_LOWER, CONTROL_HEIGHT_INCREMENT);
+PaddleController paddle2Controller(paddle2, sensor2, validPaddlePositions, CONTROL_HEIGHT_LOWER, CONTROL_HEIGHT_INCREMENT);
+// Random rebounds, seeded from the hardware RNG in setup()
+Random gameRandom;
 // Game Manager
-PixelPong pong(pixelMatrix, board, ball, paddle1, paddle2);
+PixelPong pong(display, board, ball, paddle1, paddle2, gameRandom);
 //_______ Flags
-// These all signal pending requests from the tasks or interrupt
-//that are too be acted on in the main loop
-volatile bool render = false;
-volatile bool updateState = false;
-volatile bool gameOver = false;
-volatile bool paused = true;
-volatile bool showPausedVisual = true;
-volatile bool brightnessChanged = false;
-volatile bool restart = false;
+// Game state & pending requests for the render task, only accessed holding gameStateMutex
+bool gameOver = false;
+bool paused = true;
+bool showPausedVisual = true;
+bool showWinVisual = false;
+bool brightnessChanged = false;
+//_______ Event Queues
+// Each queue has a single producer, drained in order by the game task (render ticks by the input task).
+// The buttons share the GPIO interrupt so can't preempt each other.
+SpscQueue<GameEvent, EVENT_QUEUE_SIZE> buttonEvents; // Produced by the button interrupts
+SpscQueue<GameEvent, EVENT_QUEUE_SIZE> timerEvents;  // Produced by the timer task
+SpscQueue<uint32_t, EVENT_QUEUE_SIZE> renderTicks;   // When each render timer event fired, produced by the timer task
+uint32_t maxEventLatencyMicros = 0;                  // Longest time an event has waited to be handled
+//_______ Input Logs
+uint8_t inputLogBuffers[2][INPUT_LOG_BUFFER_SIZE];
+InputLog inputLogs[2] = {InputLog(inputLogBuffers[0], INPUT_LOG_BUFFER_SIZE), InputLog(inputLogBuffers[1], INPUT_LOG_BUFFER_SIZE)};
+int recordingInputLog = 0;                  // The log the game is recorded into, only accessed holding gameStateMutex
+std::atomic<InputLog *> finishedInputLog(NULL); // A finished game handed to the log task to write out, NULL once written
 //_______ Tasks & Interrupts
-// - Tasks
-static TimerHandle_t gameEngine = NULL; // Handles updating game state, ball position, collistions etc
+// - Game Clock
+GameClock gameClock(GAME_TICK_DELAY * 1000, MAX_GAME_STEPS_PER_UPDATE); // Paces updates to game state, ball position, collisions etc
+// - Tasks (each sleeps until notified)
+static TaskHandle_t gameTaskHandle = NULL; // Handles updating game state, ball position, collisions etc
+void gameTask(void *parameters);
+static TaskHandle_t renderTaskHandle = NULL; // Handles all output to the LED matrix
+void renderTask(void *parameters);
+static TaskHandle_t inputTaskHandle = NULL; // Handles player controls (ultrasonic sensors)
+void inputTask(void *parameters);
+static TaskHandle_t logTaskHandle = NULL; // Writes buffered log records out over Serial
+void logTask(void *parameters);
+static SemaphoreHandle_t gameStateMutex = NULL; // Guards the game elements & pixel matrix shared by the tasks
+// - Task Timers (only queue events/ notify their task)
+static TimerHandle_t gameEngine = NULL;
 void updateBoardState(TimerHandle_t xTimer);
-static TimerHandle_t renderEngine = NULL; // Handles visual rendering and player controls indirectly
+static TimerHandle_t renderEngine = NULL;
 void renderScene(TimerHandle_t xTimer);
 // - Interrupts
 void IRAM_ATTR playPauseRestart();
 void IRAM_ATTR raiseBrightness();
 void IRAM_ATTR lowerBrightness();
+void IRAM_ATTR notifyTaskFromISR(TaskHandle_t task);
+void IRAM_ATTR queueButtonEvent(GameEventType type);
 //_______ Functions
-void controlPaddlePosition(Paddle &paddle, int triggerPin, int echoPin, std::vector<int> validPositions);
+void handleEvent(GameEvent event);
 void renderPausedVisual(int x1, int x2, int yMin, int yMax);
 void renderWinVisual(Velocity finalBallVelocity);
+fixed_t getBallSpeed(int numCollisions);
 void resetGame();
-std::vector<int> getValidPaddlePositions(Board &board, Paddle &paddle);
+void beginInputLog();
+void finishInputLog();
+void writeInputLog(InputLog &inputLog);
+void reportLatency(bool reset);
+void reportDeadlines(bool reset);
+void reportMemory();
+void handleSerialCommand(int command);
+void writeTrace();
+void writeSerialLine(const char *line);
+void writeProfile();
+void writeRuntimeStats();
 // ______ Variables
-int ballDelay = INITIAL_STATE_UPDATE_DELAY;
-volatile int ledBrightness = DEFAULT_BRIGHTNESS;
-std::vector<int> validPaddlePositions;
+int ledBrightness = DEFAULT_BRIGHTNESS;
+int ballSpeedCollisionCount = 0; // The collision count the ball's speed was last set for
 
 /**
  *                            SETUP
@@ -118,44 +232,50 @@ std::vector<int> validPaddlePositions;
 void setup()
 {
   Serial.begin(115200);
+  traceStart();
 
-  // BUTTONS
-  // Play/ Pause/ Restart Button
-  pinMode(PLAY_PAUSE_RESTART_BTN_PIN, INPUT_PULLUP);
-  attachInterrupt(PLAY_PAUSE_RESTART_BTN_PIN, playPauseRestart, FALLING);
-  // Brightness down
-  pinMode(BRIGHTNESS_LOWER_BTN_PIN, INPUT_PULLUP);
-  attachInterrupt(BRIGHTNESS_LOWER_BTN_PIN, lowerBrightness, FALLING);
-  // Brightness up
-  pinMode(BRIGHTNESS_RAISE_BTN_PIN, INPUT_PULLUP);
-  attachInterrupt(BRIGHTNESS_RAISE_BTN_PIN, raiseBrightness, FALLING);
-  // ULTRASONIC SENSORS (Controllers)
-  pinMode(ECHO_PIN1, INPUT);
-  pinMode(TRIGGER_PIN1, OUTPUT);
-  pinMode(ECHO_PIN2, INPUT);
-  pinMode(TRIGGER_PIN2, OUTPUT);
+  // BUTTONS & ULTRASONIC SENSORS (Controllers) are started by the input task, so their interrupts are on its core.
   // LED MATRIX (Display)
-  pixelMatrix.begin();
-  pixelMatrix.setBrightness(DEFAULT_BRIGHTNESS);
-  pixelMatrix.show();
-  // Get valid paddle positionl (can use either as paddles are intended to be the same)
-  validPaddlePositions = getValidPaddlePositions(board, paddle1);
+  for (int i = 0; i < LED_TILES_X * LED_TILES_Y; i++)
+  {
+    if (!ledChannels[i]->begin())
+    {
+      LOG_ERROR_VALUE("LED strip RMT setup failed, tile", i);
+    }
+  }
+  matrixDisplay.setBrightness(DEFAULT_BRIGHTNESS);
+  matrixDisplay.show();
+  gameRandom.seed(platformRandomSeed());
+  // Record from the starting state (the ball starts at its slowest)
+  beginInputLog();
+  resetGame();
+
+  gameClock.reset(micros());
+
+  // Create the Tasks, pinned to their cores
+  gameStateMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(renderTask, "renderTask", TASK_STACK_SIZE, NULL, RENDER_TASK_PRIORITY, &renderTaskHandle, RENDER_TASK_CORE);
+  xTaskCreatePinnedToCore(gameTask, "gameTask", TASK_STACK_SIZE, NULL, GAME_TASK_PRIORITY, &gameTaskHandle, GAME_TASK_CORE);
+  xTaskCreatePinnedToCore(inputTask, "inputTask", TASK_STACK_SIZE, NULL, INPUT_TASK_PRIORITY, &inputTaskHandle, INPUT_TASK_CORE);
+  xTaskCreatePinnedToCore(logTask, "logTask", TASK_STACK_SIZE, NULL, LOG_TASK_PRIORITY, &logTaskHandle, LOG_TASK_CORE);
+  // The paused visual is pending
+  xTaskNotifyGive(renderTaskHandle);
 
   // Create and start Task Timers
+  gameEngine = xTimerCreate(
+      "gameEngine",
+      GAME_TICK_DELAY / portTICK_PERIOD_MS,
+      pdTRUE,
+      (void *)0,
+      updateBoardState);
   renderEngine = xTimerCreate(
       "renderingEngine",
       RENDER_DELAY / portTICK_PERIOD_MS,
       pdTRUE,
-      (void *)0,
-      renderScene);
-  gameEngine = xTimerCreate(
-      "gameEngine",
-      INITIAL_STATE_UPDATE_DELAY / portTICK_PERIOD_MS,
-      pdTRUE,
       (void *)1,
-      updateBoardState);
-  xTimerStart(renderEngine, portMAX_DELAY);
+      renderScene);
   xTimerStart(gameEngine, portMAX_DELAY);
+  xTimerStart(renderEngine, portMAX_DELAY);
 }
 
 /**
@@ -164,61 +284,9 @@ void setup()
  */
 void loop()
 {
-  if (restart)
-  {
-    restart = false;
-    resetGame();
-  }
-  // Adjust the brightness if there is a pending change.
-  if (brightnessChanged)
-  {
-    brightnessChanged = false;
-    pixelMatrix.setBrightness(ledBrightness);
-    pixelMatrix.show();
-  }
-  // Render the paused visual if necessary
-  if (showPausedVisual)
-  {
-    renderPausedVisual(2, 5, 2, 5);
-    showPausedVisual = false;
-  }
-
-  // Check whether the game is in a paused state (i.e. no updates)
-  if (!paused && !gameOver)
-  {
-    // Re-render the scene if there is a pending change.
-    if (render)
-    {
-      render = false;
-      controlPaddlePosition(paddle1, TRIGGER_PIN1, ECHO_PIN1, validPaddlePositions);
-      controlPaddlePosition(paddle2, TRIGGER_PIN2, ECHO_PIN2, validPaddlePositions);
-      pong.render(std::make_tuple(BALL_COLOUR_RGB), std::make_tuple(PADDLE1_COLOUR_RBG), std::make_tuple(PADDLE2_COLOUR_RGB));
-    }
-
-    // Update game states if there is a pending change.
-    if (updateState)
-    {
-      updateState = false;
-      bool ballInWinState = pong.handle();
-      if (ballInWinState)
-      {
-        gameOver = true;
-        Serial.println("Game Over!");
-        renderWinVisual(ball.getVelocity());
-      }
-      // Alter the speed of the ball based on number of paddle collisions.
-      if (ballDelay > MIN_STATE_UPDATE_DELAY)
-      {
-        int numCollisions = pong.getPaddleCollisionCount();
-        ballDelay = (INITIAL_STATE_UPDATE_DELAY - (STATE_UPDATE_DELAY_REDUCTION_FACTOR * numCollisions));
-        if (ballDelay < MIN_STATE_UPDATE_DELAY)
-        {
-          ballDelay = MIN_STATE_UPDATE_DELAY;
-        }
-        xTimerChangePeriod(gameEngine, ballDelay / portTICK_PERIOD_MS, portMAX_DELAY);
-      }
-    }
-  }
+  // Everything runs in the tasks, no need to keep the loop task around.
+  LOG_INFO_VALUE("Loop task stack never used (bytes)", uxTaskGetStackHighWaterMark(NULL));
+  vTaskDelete(NULL);
 }
 
 /**
@@ -228,63 +296,167 @@ void loop()
 
 //======= GAME MANAGEMENT
 /**
- * @brief Handles user control of paddles.
- *    Reads the position of the ultrasonic sensor controller 
- *    and updates the paddel accordingly.
+ * @brief Act on an event from one of the queues.
+ *    Called by the game task, holding gameStateMutex.
  * 
- * @param paddle The paddle to be updated.
- * @param triggerPin The trigger pin number for the ultrasonic sensor controller
- *    corresponding to the given paddle.
- * @param echoPin The echo pin number for the ultrasonic sensor controller
- *    correspinding to the given paddle.
+ * @param event The event to handle.
  */
-void controlPaddlePosition(Paddle &paddle, int triggerPin, int echoPin, std::vector<int> validPositions)
+void handleEvent(GameEvent event)
 {
-  // Read distance from the Ultrasonic Sensor
-  digitalWrite(triggerPin, LOW);
-  delayMicroseconds(2);
-  digitalWrite(triggerPin, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(triggerPin, LOW);
-  long duration = pulseIn(echoPin, HIGH);
-  int distance = duration * 0.034 / 2;
-  // Update paddle position accoringly
-  int paddleXPosition = paddle.getPosition().x;
-  if (distance < CONTROL_HEIGHT_LOWER)
+  uint32_t nowMicros = micros();
+  uint32_t latencyMicros = nowMicros - event.timestampMicros;
+  if (latencyMicros > maxEventLatencyMicros)
   {
-    paddle.setPosition({paddleXPosition, validPositions[0]});
+    maxEventLatencyMicros = latencyMicros;
   }
-  else if (distance >= CONTROL_HEIGHT_LOWER * validPositions.size())
+  // Ticks are recorded as the steps they lead to
+  if (event.type != GAME_TICK)
   {
-    paddle.setPosition({paddleXPosition, validPositions[validPositions.size() - 1]});
+    inputLogs[recordingInputLog].recordEvent(event.type);
   }
-  else
+
+  switch (event.type)
   {
-    int rounded = ((distance + CONTROL_HEIGHT_INCREMENT - 1) / CONTROL_HEIGHT_INCREMENT) * CONTROL_HEIGHT_INCREMENT;
-    int positionIndex = (rounded / CONTROL_HEIGHT_INCREMENT) - 1;
-    paddle.setPosition({paddleXPosition, validPositions[positionIndex]});
+  case PLAY_PAUSE_RESTART_PRESSED:
+    if (gameOver)
+    {
+      resetGame();
+    }
+    else
+    {
+      paused = !paused;
+      showPausedVisual = paused;
+    }
+    xTaskNotifyGive(renderTaskHandle);
+    break;
+
+  case BRIGHTNESS_LOWER_PRESSED:
+    if (ledBrightness > MIN_BRIGHTNESS)
+    {
+      ledBrightness -= BRIGHTNESS_STEP;
+      brightnessChanged = true;
+      xTaskNotifyGive(renderTaskHandle);
+    }
+    LOG_INFO_VALUE("Brightness", ledBrightness);
+    break;
+
+  case BRIGHTNESS_RAISE_PRESSED:
+    if (ledBrightness < MAX_BRIGHTNESS)
+    {
+      ledBrightness += BRIGHTNESS_STEP;
+      brightnessChanged = true;
+      xTaskNotifyGive(renderTaskHandle);
+    }
+    break;
+
+  case GAME_TICK:
+    gameTimerDeadline.serviced(event.timestampMicros, nowMicros);
+    break;
   }
 }
 
 /**
  * @brief Rest the game to the starting state.
+ *    Recorded (along with the ball's speed) in the input log.
  */
 void resetGame()
 {
-  pixelMatrix.clear();
-  pixelMatrix.show();
-  ballDelay = INITIAL_STATE_UPDATE_DELAY;
+  display.clear();
+  display.show();
   ball.setPosition({INITIAL_BALL_POSITION});
-  ball.setVelocity({INITIAL_BALL_VELOCITY});
+  ball.setVelocity(Velocity(INITIAL_BALL_VELOCITY).withSpeed(getBallSpeed(0)));
   paddle1.setPosition({INITIAL_PADDLE_POSITION1});
   paddle2.setPosition({INITIAL_PADDLE_POSITION2});
   pong.setCollisionCount(0);
-  render = false;
-  updateState = false;
+  ballSpeedCollisionCount = 0;
   gameOver = false;
   paused = true;
   showPausedVisual = true;
+  showWinVisual = false;
   brightnessChanged = false;
+  inputLogs[recordingInputLog].recordEvent(INPUT_LOG_RESET);
+  inputLogs[recordingInputLog].recordSpeed(ball.getSpeed());
+}
+
+/**
+ * @brief Start recording the game into a new input log,
+ *    from the generator's current state.
+ */
+void beginInputLog()
+{
+  HitRegions regions = GamePaddle::regions();
+  InputLogHeader header = {
+      GameBoard::xDim, GameBoard::yDim,
+      GamePaddle::size, GamePaddle::anchor,
+      regions.topSize, regions.middleSize, regions.bottomSize,
+      gameRandom.getState()};
+  inputLogs[recordingInputLog].begin(header);
+  pong.setInputLog(&inputLogs[recordingInputLog]);
+}
+
+/**
+ * @brief Hand the finished game's input log to the log task to write
+ *    out, and start recording into the other.
+ *    If the last log is still being written out this one is dropped.
+ */
+void finishInputLog()
+{
+  InputLog *expected = NULL;
+  if (finishedInputLog.compare_exchange_strong(expected, &inputLogs[recordingInputLog]))
+  {
+    recordingInputLog = 1 - recordingInputLog;
+  }
+  else
+  {
+    LOG_WARN("Input log dropped, the last is still being written out");
+  }
+  beginInputLog();
+}
+
+/**
+ * @brief Write an input log out over Serial as lines of hex between
+ *    "# inputlog begin" & "# inputlog end" markers.
+ *    tools/extract_input_log.py turns a capture back into log files.
+ * 
+ * @param inputLog The log to write out.
+ */
+void writeInputLog(InputLog &inputLog)
+{
+  static const char hexDigits[] = "0123456789abcdef";
+  Serial.printf("# inputlog begin bytes=%u steps=%u truncated=%d\n",
+                (unsigned)inputLog.getSize(), (unsigned)inputLog.getStepCount(), inputLog.isTruncated());
+  const uint8_t *data = inputLog.getData();
+  char line[INPUT_LOG_LINE_BYTES * 2 + 2];
+  for (size_t offset = 0; offset < inputLog.getSize(); offset += INPUT_LOG_LINE_BYTES)
+  {
+    size_t lineBytes = inputLog.getSize() - offset < INPUT_LOG_LINE_BYTES ? inputLog.getSize() - offset : INPUT_LOG_LINE_BYTES;
+    for (size_t i = 0; i < lineBytes; i++)
+    {
+      line[i * 2] = hexDigits[data[offset + i] >> 4];
+      line[i * 2 + 1] = hexDigits[data[offset + i] & 0xF];
+    }
+    line[lineBytes * 2] = '\n';
+    line[lineBytes * 2 + 1] = '\0';
+    Serial.print(line);
+  }
+  Serial.print("# inputlog end\n");
+}
+
+/**
+ * @brief Calculate the speed of the ball for a number of paddle collisions.
+ *    The time taken to move one pixel starts at INITIAL_STATE_UPDATE_DELAY and
+ *    decays smoothly towards MIN_STATE_UPDATE_DELAY, SPEED_CURVE_COLLISIONS
+ *    sets how quickly.
+ * 
+ * @param numCollisions The number of ball to paddle collisions so far.
+ * 
+ * @return The speed in pixels per game tick.
+ */
+fixed_t getBallSpeed(int numCollisions)
+{
+  float ballDelay = MIN_STATE_UPDATE_DELAY +
+                    (INITIAL_STATE_UPDATE_DELAY - MIN_STATE_UPDATE_DELAY) * expf(-(float)numCollisions / SPEED_CURVE_COLLISIONS);
+  return floatToFixed(GAME_TICK_DELAY / ballDelay);
 }
 
 // ===== VISUALS
@@ -301,10 +473,10 @@ void renderPausedVisual(int x1, int x2, int yMin, int yMax)
 {
   for (int i = yMin; i <= yMax; i++)
   {
-    pixelMatrix.drawPixel(x1, i, pixelMatrix.Color(PAUSE_COLOUR_RGB));
-    pixelMatrix.drawPixel(x2, i, pixelMatrix.Color(PAUSE_COLOUR_RGB));
+    display.drawPixel(x1, i, Display::colour(PAUSE_COLOUR_RGB));
+    display.drawPixel(x2, i, Display::colour(PAUSE_COLOUR_RGB));
   }
-  pixelMatrix.show();
+  display.show();
 }
 
 /**
@@ -316,57 +488,528 @@ void renderPausedVisual(int x1, int x2, int yMin, int yMax)
 void renderWinVisual(Velocity finalBallVelocity)
 {
   // Left side won
-  if (finalBallVelocity.x == -1)
+  if (finalBallVelocity.x < 0)
   {
-    pixelMatrix.writeFillRect(0, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, pixelMatrix.Color(255, 0, 0));
-    pixelMatrix.writeFillRect(GAME_BOARD_X / 2, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, pixelMatrix.Color(0, 255, 0));
+    display.fillRect(0, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, Display::colour(255, 0, 0));
+    display.fillRect(GAME_BOARD_X / 2, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, Display::colour(0, 255, 0));
   }
   // right side won
-  if (finalBallVelocity.x == 1)
+  if (finalBallVelocity.x > 0)
   {
-    pixelMatrix.writeFillRect(0, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, pixelMatrix.Color(0, 255, 0));
-    pixelMatrix.writeFillRect(GAME_BOARD_X / 2, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, pixelMatrix.Color(255, 0, 0));
+    display.fillRect(0, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, Display::colour(0, 255, 0));
+    display.fillRect(GAME_BOARD_X / 2, 0, GAME_BOARD_X / 2, GAME_BOARD_Y, Display::colour(255, 0, 0));
   }
-  pixelMatrix.show();
+  display.show();
 }
 
 // ====== TASKS
 /**
- * @brief Task for flagging board state updates.
+ * @brief Task for updating the game state.
+ *    Woken whenever there are events queued, handles the button presses
+ *    then runs however many simulation steps are due.
+ */
+void gameTask(void *parameters)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TRACE_SCOPE(TRACE_GAME_TASK);
+    TRACE_BEGIN(TRACE_MUTEX_WAIT);
+    xSemaphoreTake(gameStateMutex, portMAX_DELAY);
+    TRACE_END(TRACE_MUTEX_WAIT);
+    GameEvent event;
+    while (buttonEvents.pop(event))
+    {
+      handleEvent(event);
+    }
+    // Ticks only say it's time to check the clock, however many are pending
+    uint32_t ticks = 0;
+    while (timerEvents.pop(event))
+    {
+      handleEvent(event);
+      ticks++;
+    }
+    if (ticks > 1)
+    {
+      gameTimerDeadline.coalesced(ticks - 1);
+    }
+
+    // Check whether the game is in a paused state (i.e. no updates)
+    if (paused || gameOver)
+    {
+      // No game time passes while paused or over
+      gameClock.reset(micros());
+    }
+    else
+    {
+      // Update game state once for every simulation step that's due.
+      int steps = gameClock.advance(micros());
+      bool wasGameOver = gameOver;
+      for (int i = 0; i < steps && !gameOver; i++)
+      {
+        bool ballInWinState;
+        {
+          LatencyTimer timer(stageLatency[STAGE_HANDLE]);
+          ballInWinState = pong.handle();
+        }
+        if (ballInWinState)
+        {
+          TRACE_INSTANT(TRACE_GAME_OVER);
+          gameOver = true;
+          showWinVisual = true;
+          LOG_INFO("Game Over!");
+          LOG_INFO_VALUE("Max event latency (us)", maxEventLatencyMicros);
+          LOG_INFO_VALUE("Frames pushed", display.getPushCount());
+          LOG_INFO_VALUE("Frames skipped (unchanged)", display.getSkippedPushCount());
+          LOG_INFO_VALUE("Panel frames sent", matrixDisplay.getTilePushCount());
+          LOG_INFO_VALUE("LED transfers", ledStrip.getTransferCount());
+          LOG_INFO_VALUE("LED bytes sent", ledStrip.getBytesSent());
+          LOG_INFO_VALUE("LED transfer waits", ledStrip.getWaitCount());
+          xTaskNotifyGive(renderTaskHandle);
+        }
+        // Alter the speed of the ball when the number of paddle collisions changes.
+        if (pong.getPaddleCollisionCount() != ballSpeedCollisionCount)
+        {
+          ballSpeedCollisionCount = pong.getPaddleCollisionCount();
+          ball.setSpeed(getBallSpeed(ballSpeedCollisionCount));
+          inputLogs[recordingInputLog].recordSpeed(ball.getSpeed());
+        }
+      }
+      if (gameOver && !wasGameOver)
+      {
+        finishInputLog();
+      }
+    }
+    xSemaphoreGive(gameStateMutex);
+  }
+}
+
+/**
+ * @brief Task for all output to the LED matrix.
+ *    Woken by the input task once the controllers have been sampled,
+ *    and whenever there's a pending visual.
+ */
+void renderTask(void *parameters)
+{
+  // Started from here so this core's profiling interrupt is serviced on it
+  if (!profiler.begin())
+  {
+    LOG_ERROR("Profiler setup failed, core 1");
+  }
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TRACE_SCOPE(TRACE_RENDER_TASK);
+    TRACE_BEGIN(TRACE_MUTEX_WAIT);
+    xSemaphoreTake(gameStateMutex, portMAX_DELAY);
+    TRACE_END(TRACE_MUTEX_WAIT);
+    // Adjust the brightness if there is a pending change.
+    if (brightnessChanged)
+    {
+      brightnessChanged = false;
+      matrixDisplay.setBrightness(ledBrightness);
+      // Same frame, so re-pushed straight to the matrix rather than through the game display
+      timedMatrixDisplay.show();
+    }
+    // Render the paused visual if necessary
+    if (showPausedVisual)
+    {
+      showPausedVisual = false;
+      renderPausedVisual(GAME_BOARD_X / 4, GAME_BOARD_X - 1 - GAME_BOARD_X / 4, GAME_BOARD_Y / 4, GAME_BOARD_Y - 1 - GAME_BOARD_Y / 4);
+    }
+    // Render the win visual if necessary
+    if (showWinVisual)
+    {
+      showWinVisual = false;
+      renderWinVisual(ball.getVelocity());
+    }
+    // Re-render the scene, unless paused or over
+    if (!paused && !gameOver)
+    {
+      LatencyTimer timer(stageLatency[STAGE_RENDER]);
+      pong.render(std::make_tuple(BALL_COLOUR_RGB), std::make_tuple(PADDLE1_COLOUR_RBG), std::make_tuple(PADDLE2_COLOUR_RGB));
+    }
+    xSemaphoreGive(gameStateMutex);
+  }
+}
+
+/**
+ * @brief Task for sampling the controllers.
+ *    Woken every RENDER_DELAY, wakes the render task straight after
+ *    so the frame shows the latest paddle positions.
+ */
+void inputTask(void *parameters)
+{
+  // Arduino installs the one GPIO interrupt (shared by every pin) on the core of the first attachInterrupt,
+  // so nothing may attach before this and the button & echo interrupts are all serviced on this core.
+  // BUTTONS
+  // Play/ Pause/ Restart Button
+  pinMode(PLAY_PAUSE_RESTART_BTN_PIN, INPUT_PULLUP);
+  attachInterrupt(PLAY_PAUSE_RESTART_BTN_PIN, playPauseRestart, FALLING);
+  // Brightness down
+  pinMode(BRIGHTNESS_LOWER_BTN_PIN, INPUT_PULLUP);
+  attachInterrupt(BRIGHTNESS_LOWER_BTN_PIN, lowerBrightness, FALLING);
+  // Brightness up
+  pinMode(BRIGHTNESS_RAISE_BTN_PIN, INPUT_PULLUP);
+  attachInterrupt(BRIGHTNESS_RAISE_BTN_PIN, raiseBrightness, FALLING);
+  // ULTRASONIC SENSORS (Controllers)
+  sensor1.begin();
+  sensor2.begin();
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TRACE_SCOPE(TRACE_INPUT_TASK);
+    TRACE_BEGIN(TRACE_MUTEX_WAIT);
+    xSemaphoreTake(gameStateMutex, portMAX_DELAY);
+    TRACE_END(TRACE_MUTEX_WAIT);
+    // Every render tick is timestamped, as game ticks are, so both timers' deadlines mean the same
+    uint32_t firedMicros;
+    uint32_t ticks = 0;
+    while (renderTicks.pop(firedMicros))
+    {
+      renderTimerDeadline.serviced(firedMicros, micros());
+      ticks++;
+    }
+    if (ticks > 1)
+    {
+      renderTimerDeadline.coalesced(ticks - 1);
+    }
+    if (!paused && !gameOver)
+    {
+      // Non-blocking, uses the latest reading from each sensor
+      {
+        LatencyTimer timer(stageLatency[STAGE_CONTROLLER1]);
+        TRACE_SCOPE(TRACE_CONTROLLER_UPDATE);
+        paddle1Controller.update();
+      }
+      {
+        LatencyTimer timer(stageLatency[STAGE_CONTROLLER2]);
+        TRACE_SCOPE(TRACE_CONTROLLER_UPDATE);
+        paddle2Controller.update();
+      }
+      xTaskNotifyGive(renderTaskHandle);
+    }
+    xSemaphoreGive(gameStateMutex);
+  }
+}
+
+/**
+ * @brief Task for writing out buffered log records & finished input logs,
+ *    and for answering commands sent over Serial.
+ *    The lowest priority, so Serial never holds up the game.
+ */
+void logTask(void *parameters)
+{
+  // Every task has been created by now (the timer task before any of them)
+  memoryMonitor.watchTask("gameTask", gameTaskHandle);
+  memoryMonitor.watchTask("renderTask", renderTaskHandle);
+  memoryMonitor.watchTask("inputTask", inputTaskHandle);
+  memoryMonitor.watchTask("logTask", logTaskHandle);
+  memoryMonitor.watchTask("timerTask", xTimerGetTimerDaemonTaskHandle());
+  memoryMonitor.sample();
+  if (!profiler.begin())
+  {
+    LOG_ERROR("Profiler setup failed, core 0");
+  }
+  uint32_t lastMemorySampleMillis = millis();
+  uint32_t lastReportMillis = millis();
+  for (;;)
+  {
+    TRACE_BEGIN(TRACE_LOG_TASK);
+    logDrain(LOG_BUFFER_SIZE);
+    while (Serial.available() > 0)
+    {
+      handleSerialCommand(Serial.read());
+    }
+    if (REPORT_DELAY > 0 && millis() - lastReportMillis >= REPORT_DELAY)
+    {
+      lastReportMillis = millis();
+      reportLatency(false);
+      reportDeadlines(false);
+    }
+    if (millis() - lastMemorySampleMillis >= MEMORY_SAMPLE_DELAY)
+    {
+      lastMemorySampleMillis = millis();
+      memoryMonitor.sample();
+    }
+    // Written out here as it can take seconds, the game task has moved on to the other log
+    InputLog *inputLog = finishedInputLog.load();
+    if (inputLog != NULL)
+    {
+      writeInputLog(*inputLog);
+      finishedInputLog.store(NULL);
+    }
+    uint32_t dropped = getLogDroppedCount();
+    static uint32_t reportedDropped = 0;
+    if (dropped != reportedDropped)
+    {
+      reportedDropped = dropped;
+      LOG_WARN_VALUE("Log records dropped", dropped);
+    }
+    TRACE_END(TRACE_LOG_TASK);
+    vTaskDelay(LOG_DRAIN_DELAY / portTICK_PERIOD_MS);
+  }
+}
+
+// ====== INSTRUMENTATION
+/**
+ * @brief Act on a command sent over Serial.
+ *    'l' reports the frame stage latencies, 'd' the timer deadlines,
+ *    'c' reports & clears both, 't' writes out the trace, 'm' the memory history.
+ * 
+ * @param command The character received.
+ */
+void handleSerialCommand(int command)
+{
+  switch (command)
+  {
+  case 'l':
+    reportLatency(false);
+    break;
+
+  case 'd':
+    reportDeadlines(false);
+    break;
+
+  case 'c':
+    reportLatency(true);
+    reportDeadlines(true);
+    break;
+
+  case 't':
+    writeTrace();
+    break;
+
+  case 'm':
+    reportMemory();
+    break;
+
+  case 'p':
+    writeProfile();
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Write the p50/p99/max time taken by each frame stage out over
+ *    Serial as CSV, between "# latency begin" & "# latency end" markers.
+ *    Each histogram is copied holding gameStateMutex, then formatted
+ *    without it so Serial never holds up the game.
+ * 
+ * @param reset Whether or not to clear the histograms once copied.
+ */
+void reportLatency(bool reset)
+{
+  static LatencyHistogram snapshot;
+  char row[96];
+  Serial.println("# latency begin");
+  Serial.println(LATENCY_CSV_HEADER);
+  for (int i = 0; i < STAGE_COUNT; i++)
+  {
+    xSemaphoreTake(gameStateMutex, portMAX_DELAY);
+    snapshot = stageLatency[i];
+    if (reset)
+    {
+      stageLatency[i].reset();
+    }
+    xSemaphoreGive(gameStateMutex);
+    // CCOUNT counts CPU cycles
+    formatLatencyHistogram(stageNames[i], snapshot, getCpuFrequencyMhz(), row, sizeof(row));
+    Serial.println(row);
+  }
+  Serial.println("# latency end");
+}
+
+/**
+ * @brief Write how promptly each timer's events have been serviced (lag,
+ *    jitter, late, missed, coalesced & dropped ticks) out over Serial as
+ *    CSV, between "# deadlines begin" & "# deadlines end" markers.
+ * 
+ * @param reset Whether or not to clear the monitors once copied.
+ */
+void reportDeadlines(bool reset)
+{
+  static DeadlineMonitor snapshot(0);
+  DeadlineMonitor *monitors[] = {&gameTimerDeadline, &renderTimerDeadline};
+  const char *names[] = {"gameEngine", "renderEngine"};
+  char row[160];
+  Serial.println("# deadlines begin");
+  Serial.println(DEADLINE_CSV_HEADER);
+  for (int i = 0; i < 2; i++)
+  {
+    xSemaphoreTake(gameStateMutex, portMAX_DELAY);
+    snapshot = *monitors[i];
+    // Game ticks are lost to a full queue, or as steps the clock couldn't catch up on
+    uint32_t dropped = i == 0 ? timerEvents.getDroppedCount() + gameClock.getDroppedStepCount() : renderTicks.getDroppedCount();
+    if (reset)
+    {
+      monitors[i]->reset();
+    }
+    xSemaphoreGive(gameStateMutex);
+    formatDeadlineMonitor(names[i], snapshot, dropped, row, sizeof(row));
+    Serial.println(row);
+  }
+  Serial.println("# deadlines end");
+}
+
+/**
+ * @brief Take a memory sample, then write every sample kept out over
+ *    Serial as CSV (oldest first), between "# memory begin" & "# memory end"
+ *    markers. Called by the log task, which owns the monitor.
+ */
+void reportMemory()
+{
+  char row[256];
+  memoryMonitor.sample();
+  Serial.printf("# memory begin samples=%d total=%lu\n", memoryMonitor.getSampleCount(), (unsigned long)memoryMonitor.getTotalSampleCount());
+  formatMemoryHeader(memoryMonitor, row, sizeof(row));
+  Serial.println(row);
+  for (int i = 0; i < memoryMonitor.getSampleCount(); i++)
+  {
+    formatMemorySample(memoryMonitor, memoryMonitor.getSample(i), row, sizeof(row));
+    Serial.println(row);
+  }
+  Serial.println("# memory end");
+}
+
+/**
+ * @brief Write the latest trace events out over Serial as lines of hex
+ *    between "# trace begin" & "# trace end" markers, then start tracing
+ *    afresh. tools/trace2chrome.py turns a capture into Chrome trace JSON.
+ *    Tracing is stopped while it's written out, so it can't be overwritten.
+ */
+void writeTrace()
+{
+  traceStop();
+  // Let any event being written on the other core finish
+  vTaskDelay(1);
+  uint32_t events = traceDump(writeSerialLine);
+  traceStart();
+  LOG_INFO_VALUE("Trace events written", events);
+}
+
+/**
+ * @brief Write a line of a trace or profile out over Serial.
+ * 
+ * @param line The line, including its newline.
+ */
+void writeSerialLine(const char *line)
+{
+  Serial.print(line);
+}
+
+/**
+ * @brief Write the samples taken on each core out over Serial between
+ *    "# profile begin" & "# profile end" markers (@see writeProfileTable),
+ *    then start profiling afresh. tools/symbolise_profile.py resolves a
+ *    capture against the firmware ELF.
+ *    Sampling is stopped while it's written out, so the tables hold still.
+ */
+void writeProfile()
+{
+  profiler.stop();
+  // Let a sample being recorded on the other core finish
+  vTaskDelay(1);
+  Serial.printf("# profile begin hz=%lu cores=%d\n", (unsigned long)profiler.getHz(), PROFILE_CORES);
+  Serial.println(PROFILE_CSV_HEADER);
+  for (int core = 0; core < PROFILE_CORES; core++)
+  {
+    writeProfileTable(profiler.getTable(core), core, writeSerialLine);
+  }
+  writeRuntimeStats();
+  Serial.println("# profile end");
+  profiler.clear();
+  profiler.start();
+}
+
+/**
+ * @brief Write the run time FreeRTOS has counted for each task out over
+ *    Serial, as "# profile runtime" lines (percent, count & name). Exact
+ *    where the samples are statistical, but only kept when FreeRTOS is
+ *    built with configGENERATE_RUN_TIME_STATS.
+ */
+void writeRuntimeStats()
+{
+#if configGENERATE_RUN_TIME_STATS
+  static TaskStatus_t tasks[PROFILE_MAX_RUNTIME_TASKS]; // Too big for the log task's stack
+  uint32_t totalRunTime = 0;
+  UBaseType_t taskCount = uxTaskGetSystemState(tasks, PROFILE_MAX_RUNTIME_TASKS, &totalRunTime);
+  for (UBaseType_t i = 0; i < taskCount && totalRunTime > 0; i++)
+  {
+    Serial.printf("# profile runtime %lu %lu %s\n", (unsigned long)((uint64_t)tasks[i].ulRunTimeCounter * 100 / totalRunTime),
+                  (unsigned long)tasks[i].ulRunTimeCounter, tasks[i].pcTaskName);
+  }
+#endif
+}
+
+// ====== TASK TIMERS
+/**
+ * @brief Timer for queueing game ticks (and waking the game task).
  */
 void updateBoardState(TimerHandle_t xTimer)
 {
-  updateState = true;
+  TRACE_SCOPE(TRACE_GAME_TIMER);
+  GameEvent event = {GAME_TICK, (uint32_t)micros()};
+  timerEvents.push(event);
+  xTaskNotifyGive(gameTaskHandle);
 }
 
 /**
- * @brief Task for flagging rendering updates.
+ * @brief Timer for waking the input task (which then wakes the render task).
  */
 void renderScene(TimerHandle_t xTimer)
 {
-  render = true;
+  TRACE_SCOPE(TRACE_RENDER_TIMER);
+  renderTicks.push((uint32_t)micros());
+  xTaskNotifyGive(inputTaskHandle);
 }
 
 // ======= INTERRUPS
+/**
+ * @brief Wake a task from an interrupt handler.
+ * 
+ * @param task The task to notify (ignored until it has been created).
+ */
+void IRAM_ATTR notifyTaskFromISR(TaskHandle_t task)
+{
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  if (task != NULL)
+  {
+    vTaskNotifyGiveFromISR(task, &higherPriorityTaskWoken);
+  }
+  if (higherPriorityTaskWoken)
+  {
+    portYIELD_FROM_ISR();
+  }
+}
+
+/**
+ * @brief Queue a button press for the game task.
+ * 
+ * @param type The button pressed.
+ */
+void IRAM_ATTR queueButtonEvent(GameEventType type)
+{
+  GameEvent event = {type, (uint32_t)micros()};
+  buttonEvents.push(event);
+  notifyTaskFromISR(gameTaskHandle);
+}
+
 /**
  * @brief Interrupt handler for playing, pausing & restarting the game.
  */
 void IRAM_ATTR playPauseRestart()
 {
+  TRACE_SCOPE(TRACE_BUTTON_INTERRUPT);
   // Debouncing
   static uint32_t playPauseRestartLastMillis = 0;
   if (millis() - playPauseRestartLastMillis > 500)
   {
     playPauseRestartLastMillis = millis();
-    if (gameOver)
-    {
-      restart = true;
-    }
-    else
-    {
-      paused = !paused;
-      showPausedVisual = !showPausedVisual;
-    }
+    queueButtonEvent(PLAY_PAUSE_RESTART_PRESSED);
   }
 }
 
@@ -375,18 +1018,14 @@ void IRAM_ATTR playPauseRestart()
  */
 void IRAM_ATTR lowerBrightness()
 {
+  TRACE_SCOPE(TRACE_BUTTON_INTERRUPT);
   // Debouncing
   static uint32_t lowerBrightnessLastMillis = 0;
   if (millis() - lowerBrightnessLastMillis > 250)
   {
     lowerBrightnessLastMillis = millis();
-    if (ledBrightness > MIN_BRIGHTNESS)
-    {
-      ledBrightness -= BRIGHTNESS_STEP;
-      brightnessChanged = true;
-    }
+    queueButtonEvent(BRIGHTNESS_LOWER_PRESSED);
   }
-  Serial.println(ledBrightness);
 }
 
 /**
@@ -394,36 +1033,12 @@ void IRAM_ATTR lowerBrightness()
  */
 void IRAM_ATTR raiseBrightness()
 {
+  TRACE_SCOPE(TRACE_BUTTON_INTERRUPT);
   // Debouncing
   static uint32_t raiseBrightnessLastMillis = 0;
   if (millis() - raiseBrightnessLastMillis > 250)
   {
     raiseBrightnessLastMillis = millis();
-    if (ledBrightness < MAX_BRIGHTNESS)
-    {
-      ledBrightness += BRIGHTNESS_STEP;
-      brightnessChanged = true;
-    }
+    queueButtonEvent(BRIGHTNESS_RAISE_PRESSED);
   }
 }
-
-/**
- * @brief Calculate the valid Y coordinate for paddles based on their size,
- *    anchor point and the board size.
- * 
- * @param board The game board.
- * @param paddle A paddle used in the game (assumes both game paddles are the same)
- * 
- * @return A vector of the valid Y coordinates.
- */
-std::vector<int> getValidPaddlePositions(Board &board, Paddle &paddle)
-{
-  int maxY = (board.getYDim() - 1) - (paddle.getSize() - 1 - paddle.getAnchorIndex());
-  int minY = paddle.getAnchorIndex();
-  int yRange = (maxY - minY) + 1;
-
-  std::vector<int> validePositions(yRange);
-  std::generate(validePositions.begin(), validePositions.end(), [n = minY]() mutable { return n++; });
-
-  return validePositions;
-}
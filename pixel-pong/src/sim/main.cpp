@@ -0,0 +1,674 @@
+#include <Simulator.h>
+#include <AllocationCounter.h>
+#include <NullDisplay.h>
+#include <FrameDiffDisplay.h>
+#include <FrameBufferDisplay.h>
+#include <TerminalDisplay.h>
+#include <PpmDisplay.h>
+#include <TiledDisplay.h>
+#include <MockLedChannel.h>
+#include <TransitionTable.h>
+#include <GameGeometry.h>
+#include <Platform.h>
+#include <InputLog.h>
+#include <Trace.h>
+#include <GameConfig.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+/**
+ * Headless simulator for PixelPong (env:native).
+ * Runs the game logic with scripted paddles as fast as the CPU allows.
+ *
+ * Usage: simulator [--ticks N] [--p1 SCRIPT] [--p2 SCRIPT] [--cycle i,j,k...]
+ *                  [--speed PIXELS_PER_TICK] [--render-every N] [--log]
+ *                  [--display null|framebuffer|ansi] [--ppm FILE]
+ *                  [--board WxH] [--tiles COLUMNSxROWS]
+ *                  [--validate-table] [--seed N]
+ *                  [--record FILE] [--replay FILE]... [--latency]
+ *                  [--trace FILE]
+ *    SCRIPT is one of hold, track, sweep, cycle (default track).
+ *    --display picks where rendered frames go (default null), framebuffer
+ *    keeps them in memory, ansi draws them in the terminal.
+ *    --ppm writes every frame to FILE as a PPM image instead.
+ *    Frames are only rendered with --render-every.
+ *    --board sets the size of the board (default GAME_BOARD_X by GAME_BOARD_Y).
+ *    --tiles sends frames to a grid of LED panels, each on its own (mock)
+ *    channel, and prints how long each frame would take to send.
+ *    --seed sets the seed for random rebounds (default RANDOM_DEFAULT_SEED),
+ *    a run repeats exactly given the same arguments.
+ *    --validate-table checks the table against PixelPong::handle() for
+ *    every state and exits, failing (exit code 1) on any mismatch.
+ *    --record writes an input log of the run to FILE @see InputLog
+ *    --replay re-runs a recorded input log (from here or a device, may be
+ *    given more than once) through PixelPong::handle() and exits, failing
+ *    (exit code 1) if any step's state hash doesn't match the recording.
+ *    --latency times every handle() & render() and prints their
+ *    p50/p99/max in cycles @see platformCycleCount
+ *    --trace writes the last TRACE_BUFFER_SIZE trace events of the run to
+ *    FILE, in the same form as the device writes them out over Serial
+ *    (needs -DPONG_TRACE=1) @see Trace.h
+ *
+ * Results are printed as key=value lines.
+ * When built with PONG_COUNT_ALLOCATIONS the run fails (exit code 1)
+ * if any tick allocated on the heap.
+ */
+
+/**
+ * @brief The default game and its transition table.
+ */
+typedef BoardGeometry<GAME_BOARD_X, GAME_BOARD_Y> GameBoard;
+typedef PaddleGeometry<GAME_PADDLE_SIZE, GAME_PADDLE_ANCHOR, GAME_PADDLE_HIT_REGIONS> GamePaddle;
+typedef TransitionTable<GameBoard, GamePaddle> GameTransitionTable;
+static constexpr GameTransitionTable transitionTable = GameTransitionTable::generate();
+
+/**
+ * @brief Parse the name of a paddle script.
+ * 
+ * @param name The name of the script.
+ * @param script Set to the parsed script.
+ * 
+ * @return Whether or not the name was valid.
+ */
+bool parseScript(const char *name, PaddleScript &script)
+{
+  if (strcmp(name, "hold") == 0)
+  {
+    script = HOLD;
+  }
+  else if (strcmp(name, "track") == 0)
+  {
+    script = TRACK;
+  }
+  else if (strcmp(name, "sweep") == 0)
+  {
+    script = SWEEP;
+  }
+  else if (strcmp(name, "cycle") == 0)
+  {
+    script = CYCLE;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Parse a pair of sizes, e.g. 16x8.
+ * 
+ * @param text The text to parse.
+ * @param x Set to the first size.
+ * @param y Set to the second size.
+ * 
+ * @return Whether or not the text was a valid (positive) pair.
+ */
+bool parseSize(const char *text, int &x, int &y)
+{
+  return sscanf(text, "%dx%d", &x, &y) == 2 && x > 0 && y > 0;
+}
+
+/**
+ * @brief Parse a comma separated list of valid position indices.
+ * 
+ * @param list The list to parse.
+ * 
+ * @return The parsed indices.
+ */
+std::vector<int> parseCycle(const char *list)
+{
+  std::vector<int> cycle;
+  const char *cursor = list;
+  while (*cursor != '\0')
+  {
+    char *end;
+    long index = strtol(cursor, &end, 10);
+    if (end == cursor)
+    {
+      break;
+    }
+    cycle.push_back(index);
+    cursor = (*end == ',') ? end + 1 : end;
+  }
+  return cycle;
+}
+
+/**
+ * @brief Check whether an outcome of the transition table matches the
+ *    state of the game after a step of PixelPong::handle().
+ * 
+ * @param outcome The outcome from the table.
+ * @param ball The ball after the step.
+ * @param hits The number of paddle collisions during the step.
+ * @param win Whether or not the step ended in a win state.
+ * 
+ * @return Whether or not they match.
+ */
+bool outcomeMatches(uint16_t outcome, Ball &ball, int hits, bool win)
+{
+  PrecisePosition position = ball.getPrecisePosition();
+  Velocity velocity = ball.getVelocity();
+  return position.x == intToFixed((int)((outcome >> TRANSITION_X_SHIFT) & 0xF) - 1) &&
+         position.y == intToFixed((outcome >> TRANSITION_Y_SHIFT) & 0xF) &&
+         velocity.x == intToFixed((outcome >> TRANSITION_LEFT_SHIFT) & 1 ? -1 : 1) &&
+         velocity.y == intToFixed((int)((outcome >> TRANSITION_VY_SHIFT) & 0x3) - 1) &&
+         hits == (int)((outcome >> TRANSITION_HITS_SHIFT) & 0x3) &&
+         win == (bool)((outcome >> TRANSITION_WIN_SHIFT) & 1);
+}
+
+/**
+ * @brief Compare the transition table against PixelPong::handle() for
+ *    every state of the default game, and every choice of rebound.
+ *    Each state is stepped once per choice, with the random generator
+ *    seeded so the rebound handle() draws is that choice. A random state
+ *    has to match the outcome stored for each choice, any other state its
+ *    single outcome whichever way the draw would have gone.
+ * 
+ * @param table The table to check.
+ * 
+ * @return The number of states that didn't match.
+ */
+int validateTransitionTable(const TransitionTableView &table)
+{
+  NullDisplay display;
+  Random random;
+  Ball ball(Position(0, 0), Velocity(1, 0));
+  Paddle paddle1(GamePaddle::size, GamePaddle::anchor, Position(0, 0), GamePaddle::regions());
+  Paddle paddle2(GamePaddle::size, GamePaddle::anchor, Position(GameBoard::xDim - 1, 0), GamePaddle::regions());
+  Board board(GameBoard::xDim, GameBoard::yDim, ball, paddle1, paddle2);
+  PixelPong pong(display, board, ball, paddle1, paddle2, random);
+
+  // A seed whose first draw is each choice
+  uint32_t choiceSeeds[TRANSITION_CHOICES];
+  for (int choice = 0; choice < TRANSITION_CHOICES; choice++)
+  {
+    uint32_t seed = 1;
+    for (Random draw(seed); draw.nextBelow(TRANSITION_CHOICES) != choice; draw.seed(++seed))
+    {
+    }
+    choiceSeeds[choice] = seed;
+  }
+
+  int mismatches = 0;
+  for (int x = 0; x < table.boardX; x++)
+  {
+    for (int y = 0; y < table.boardY; y++)
+    {
+      for (int vx = -1; vx <= 1; vx += 2)
+      {
+        for (int vy = -1; vy <= 1; vy++)
+        {
+          for (int p1 = 0; p1 < table.paddlePositionCount; p1++)
+          {
+            for (int p2 = 0; p2 < table.paddlePositionCount; p2++)
+            {
+              const uint16_t *outcomes = table.outcomes + transitionStateIndex(table.boardY, table.paddlePositionCount, x, y, vx, vy, p1, p2) * TRANSITION_CHOICES;
+              bool randomOutcome = (outcomes[0] >> TRANSITION_RANDOM_SHIFT) & 1;
+              for (int choice = 0; choice < TRANSITION_CHOICES; choice++)
+              {
+                ball.setPosition(Position(x, y));
+                ball.setVelocity(Velocity(vx, vy));
+                paddle1.setPosition(Position(0, p1 + table.paddleAnchor));
+                paddle2.setPosition(Position(table.boardX - 1, p2 + table.paddleAnchor));
+                pong.setCollisionCount(0);
+                random.seed(choiceSeeds[choice]);
+                bool win = pong.handle();
+                int hits = pong.getPaddleCollisionCount();
+
+                if (!outcomeMatches(outcomes[randomOutcome ? choice : 0], ball, hits, win))
+                {
+                  fprintf(stderr, "mismatch: ball (%d, %d) velocity (%d, %d) paddles %d %d choice %d\n", x, y, vx, vy, p1, p2, choice);
+                  mismatches++;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return mismatches;
+}
+
+/**
+ * @brief Read a whole file.
+ * 
+ * @param path The path of the file.
+ * @param data Set to the contents of the file.
+ * 
+ * @return Whether or not the file could be read.
+ */
+bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    return false;
+  }
+  uint8_t chunk[4096];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+  {
+    data.insert(data.end(), chunk, chunk + read);
+  }
+  bool ok = !ferror(file);
+  fclose(file);
+  return ok;
+}
+
+/**
+ * @brief Where --trace writes the trace.
+ */
+static FILE *traceFile = NULL;
+
+/**
+ * @brief Write a line of the trace to the trace file.
+ *
+ * @param line The line, including its newline.
+ */
+void writeTraceLine(const char *line)
+{
+  if (traceFile != NULL)
+  {
+    fputs(line, traceFile);
+  }
+}
+
+/**
+ * @brief Replay recorded input logs, each in a simulator set up from its header.
+ * 
+ * @param paths The paths of the logs.
+ * 
+ * @return The exit code, 1 if any log was invalid or didn't replay the same.
+ */
+int replayInputLogs(const std::vector<const char *> &paths)
+{
+  unsigned long steps = 0;
+  unsigned long games = 0;
+  unsigned long checkpoints = 0;
+  unsigned long mismatches = 0;
+  unsigned long elapsedMicros = 0;
+  int failures = 0;
+  for (const char *path : paths)
+  {
+    std::vector<uint8_t> data;
+    InputLogHeader header;
+    if (!readFile(path, data) || !InputLogReader(data.data(), data.size()).readHeader(header))
+    {
+      fprintf(stderr, "error: %s isn't a readable input log\n", path);
+      failures++;
+      continue;
+    }
+    HitRegions hitRegions = {header.topSize, header.middleSize, header.bottomSize};
+    if (header.boardX * header.boardY > MAX_FRAME_PIXELS || header.boardX < 3 || header.boardY < header.paddleSize ||
+        header.paddleAnchor >= header.paddleSize || hitRegions.topSize + hitRegions.middleSize + hitRegions.bottomSize != header.paddleSize)
+    {
+      fprintf(stderr, "error: %s was recorded on a board that can't be simulated\n", path);
+      failures++;
+      continue;
+    }
+
+    // The ball's speed is set from the log
+    SimulationConfig config = {
+        header.boardX,
+        header.boardY,
+        header.paddleSize,
+        header.paddleAnchor,
+        hitRegions,
+        {INITIAL_BALL_POSITION_ON(header.boardX, header.boardY)},
+        Velocity(INITIAL_BALL_VELOCITY),
+        {INITIAL_PADDLE_POSITION1_ON(header.boardX, header.boardY)},
+        {INITIAL_PADDLE_POSITION2_ON(header.boardX, header.boardY)},
+        CONTROL_HEIGHT_LOWER,
+        CONTROL_HEIGHT_INCREMENT,
+        header.seed};
+    NullDisplay display;
+    Simulator simulator(config, display);
+    ReplayResult result = simulator.replay(data.data(), data.size());
+    if (result.mismatches > 0)
+    {
+      fprintf(stderr, "mismatch: %s diverged at step %ld (%lu mismatches)\n", path, result.firstMismatchStep, result.mismatches);
+      failures++;
+    }
+    steps += result.steps;
+    games += result.games;
+    checkpoints += result.checkpoints;
+    mismatches += result.mismatches;
+    elapsedMicros += result.elapsedMicros;
+  }
+
+  double seconds = elapsedMicros / 1e6;
+  printf("replay_logs=%lu\n", (unsigned long)paths.size());
+  printf("replay_steps=%lu\n", steps);
+  printf("replay_games=%lu\n", games);
+  printf("replay_checkpoints=%lu\n", checkpoints);
+  printf("replay_mismatches=%lu\n", mismatches);
+  printf("replay_failures=%d\n", failures);
+  printf("elapsed_us=%lu\n", elapsedMicros);
+  printf("steps_per_second=%.0f\n", seconds > 0 ? steps / seconds : 0.0);
+  return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long ticks = 10000000;
+  unsigned long renderInterval = 0;
+  PaddleScript paddle1Script = TRACK;
+  PaddleScript paddle2Script = TRACK;
+  std::vector<int> cycle;
+  double speed = 1.0;
+  bool log = false;
+  const char *displayName = "null";
+  const char *ppmPath = NULL;
+  int boardX = GAME_BOARD_X;
+  int boardY = GAME_BOARD_Y;
+  int tilesX = 0;
+  int tilesY = 0;
+  bool validateTable = false;
+  uint32_t seed = RANDOM_DEFAULT_SEED;
+  const char *recordPath = NULL;
+  std::vector<const char *> replayPaths;
+  bool latency = false;
+  const char *tracePath = NULL;
+
+  for (int i = 1; i < argc; i++)
+  {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "--ticks") == 0 && hasValue)
+    {
+      ticks = strtoul(argv[++i], NULL, 10);
+    }
+    else if (strcmp(argv[i], "--render-every") == 0 && hasValue)
+    {
+      renderInterval = strtoul(argv[++i], NULL, 10);
+    }
+    else if (strcmp(argv[i], "--p1") == 0 && hasValue && parseScript(argv[i + 1], paddle1Script))
+    {
+      i++;
+    }
+    else if (strcmp(argv[i], "--p2") == 0 && hasValue && parseScript(argv[i + 1], paddle2Script))
+    {
+      i++;
+    }
+    else if (strcmp(argv[i], "--cycle") == 0 && hasValue)
+    {
+      cycle = parseCycle(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--speed") == 0 && hasValue)
+    {
+      speed = strtod(argv[++i], NULL);
+    }
+    else if (strcmp(argv[i], "--log") == 0)
+    {
+      log = true;
+    }
+    else if (strcmp(argv[i], "--display") == 0 && hasValue)
+    {
+      displayName = argv[++i];
+    }
+    else if (strcmp(argv[i], "--ppm") == 0 && hasValue)
+    {
+      ppmPath = argv[++i];
+    }
+    else if (strcmp(argv[i], "--board") == 0 && hasValue && parseSize(argv[i + 1], boardX, boardY))
+    {
+      i++;
+    }
+    else if (strcmp(argv[i], "--tiles") == 0 && hasValue && parseSize(argv[i + 1], tilesX, tilesY))
+    {
+      i++;
+    }
+    else if (strcmp(argv[i], "--validate-table") == 0)
+    {
+      validateTable = true;
+    }
+    else if (strcmp(argv[i], "--seed") == 0 && hasValue)
+    {
+      seed = strtoul(argv[++i], NULL, 0);
+    }
+    else if (strcmp(argv[i], "--record") == 0 && hasValue)
+    {
+      recordPath = argv[++i];
+    }
+    else if (strcmp(argv[i], "--replay") == 0 && hasValue)
+    {
+      replayPaths.push_back(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--latency") == 0)
+    {
+      latency = true;
+    }
+    else if (strcmp(argv[i], "--trace") == 0 && hasValue)
+    {
+      tracePath = argv[++i];
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [--ticks N] [--p1 hold|track|sweep|cycle] [--p2 ...] [--cycle i,j,k] [--speed PIXELS_PER_TICK] [--render-every N] [--log] [--display null|framebuffer|ansi] [--ppm FILE] [--board WxH] [--tiles COLUMNSxROWS] [--validate-table] [--seed N] [--record FILE] [--replay FILE]... [--latency] [--trace FILE]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (boardX * boardY > MAX_FRAME_PIXELS || boardY < GAME_PADDLE_SIZE)
+  {
+    fprintf(stderr, "error: the board must fit the paddles and be no more than %d pixels\n", MAX_FRAME_PIXELS);
+    return 2;
+  }
+  if (tilesX > 0 && (boardX % tilesX != 0 || boardY % tilesY != 0 || tilesX * tilesY > MAX_TILES))
+  {
+    fprintf(stderr, "error: the tiles must divide the board evenly and be no more than %d\n", MAX_TILES);
+    return 2;
+  }
+  if (recordPath != NULL && (boardX > 255 || boardY > INPUT_LOG_MAX_Y + 1))
+  {
+    fprintf(stderr, "error: input logs hold boards of up to 255 by %d pixels\n", INPUT_LOG_MAX_Y + 1);
+    return 2;
+  }
+
+  if (tracePath != NULL && !PONG_TRACE)
+  {
+    fprintf(stderr, "error: --trace needs the simulator built with -DPONG_TRACE=1\n");
+    return 2;
+  }
+
+  platformSetLogEnabled(log);
+
+  if (validateTable)
+  {
+    TransitionTableView tableView = transitionTable.view();
+    int mismatches = validateTransitionTable(tableView);
+    printf("table_states=%d\n", tableView.stateCount);
+    printf("table_bytes=%lu\n", (unsigned long)sizeof(transitionTable));
+    printf("table_mismatches=%d\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+  }
+  if (!replayPaths.empty())
+  {
+    return replayInputLogs(replayPaths);
+  }
+
+  SimulationConfig config = {
+      boardX,
+      boardY,
+      GAME_PADDLE_SIZE,
+      GAME_PADDLE_ANCHOR,
+      {GAME_PADDLE_HIT_REGIONS},
+      {INITIAL_BALL_POSITION_ON(boardX, boardY)},
+      Velocity(INITIAL_BALL_VELOCITY).withSpeed(floatToFixed(speed)),
+      {INITIAL_PADDLE_POSITION1_ON(boardX, boardY)},
+      {INITIAL_PADDLE_POSITION2_ON(boardX, boardY)},
+      CONTROL_HEIGHT_LOWER,
+      CONTROL_HEIGHT_INCREMENT,
+      seed};
+  FILE *ppmFile = NULL;
+  if (ppmPath != NULL)
+  {
+    ppmFile = fopen(ppmPath, "wb");
+    if (ppmFile == NULL)
+    {
+      fprintf(stderr, "error: couldn't open %s\n", ppmPath);
+      return 2;
+    }
+  }
+
+  NullDisplay nullDisplay;
+  FrameBufferDisplay frameBufferDisplay(boardX, boardY);
+  TerminalDisplay terminalDisplay(stdout, boardX, boardY);
+  PpmDisplay ppmDisplay(ppmFile, boardX, boardY);
+  MockLedChannel ledChannels[MAX_TILES] = {
+      TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL,
+      TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL, TILE_BYTES_PER_PIXEL};
+  LedChannel *ledChannelPointers[MAX_TILES];
+  for (int i = 0; i < MAX_TILES; i++)
+  {
+    ledChannelPointers[i] = &ledChannels[i];
+  }
+  TiledDisplay tiledDisplay(ledChannelPointers, tilesX, tilesY, tilesX > 0 ? boardX / tilesX : 0, tilesY > 0 ? boardY / tilesY : 0, TILE_ZIGZAG);
+  Display *sink = &nullDisplay;
+  // Set when the frames can be hashed
+  FrameBufferDisplay *frameSink = NULL;
+  if (ppmFile != NULL)
+  {
+    frameSink = &ppmDisplay;
+  }
+  else if (strcmp(displayName, "framebuffer") == 0)
+  {
+    frameSink = &frameBufferDisplay;
+  }
+  else if (strcmp(displayName, "ansi") == 0)
+  {
+    frameSink = &terminalDisplay;
+  }
+  else if (strcmp(displayName, "null") != 0)
+  {
+    fprintf(stderr, "error: unknown display %s\n", displayName);
+    return 2;
+  }
+  if (frameSink != NULL)
+  {
+    sink = frameSink;
+  }
+  if (tilesX > 0)
+  {
+    if (frameSink != NULL)
+    {
+      fprintf(stderr, "error: --tiles can't be used with --display or --ppm\n");
+      return 2;
+    }
+    sink = &tiledDisplay;
+  }
+  // Frames only reach the sink when they change, as on the device
+  FrameDiffDisplay display(*sink, boardX, boardY);
+  Simulator simulator(config, display);
+  simulator.setScripts(paddle1Script, paddle2Script, cycle);
+  simulator.setRenderInterval(renderInterval);
+  // Room for every tick to end a game (a step, a checkpoint, a reset & a speed), allocated up front
+  std::vector<uint8_t> recordBuffer;
+  InputLog inputLog(NULL, 0);
+  if (recordPath != NULL)
+  {
+    size_t tickSize = INPUT_LOG_STEP_SIZE + INPUT_LOG_CHECKPOINT_SIZE + INPUT_LOG_EVENT_SIZE + INPUT_LOG_SPEED_SIZE;
+    recordBuffer.resize(INPUT_LOG_HEADER_SIZE + INPUT_LOG_EVENT_SIZE + INPUT_LOG_SPEED_SIZE + ticks * tickSize);
+    inputLog = InputLog(recordBuffer.data(), recordBuffer.size());
+    simulator.setInputLog(&inputLog);
+  }
+
+  LatencyHistogram handleLatency;
+  LatencyHistogram renderLatency;
+  if (latency)
+  {
+    simulator.setLatencyHistograms(&handleLatency, &renderLatency);
+  }
+
+  if (tracePath != NULL)
+  {
+    traceStart();
+  }
+  unsigned long allocationsBefore = getAllocationCount();
+  SimulationResult result = simulator.run(ticks);
+  unsigned long tickAllocations = getAllocationCount() - allocationsBefore;
+  traceStop();
+  if (ppmFile != NULL)
+  {
+    fclose(ppmFile);
+  }
+  if (recordPath != NULL)
+  {
+    FILE *recordFile = fopen(recordPath, "wb");
+    if (recordFile == NULL || fwrite(inputLog.getData(), 1, inputLog.getSize(), recordFile) != inputLog.getSize())
+    {
+      fprintf(stderr, "error: couldn't write %s\n", recordPath);
+      return 2;
+    }
+    fclose(recordFile);
+  }
+  uint32_t traceEvents = 0;
+  if (tracePath != NULL)
+  {
+    traceFile = fopen(tracePath, "w");
+    if (traceFile == NULL)
+    {
+      fprintf(stderr, "error: couldn't open %s\n", tracePath);
+      return 2;
+    }
+    traceEvents = traceDump(writeTraceLine);
+    fclose(traceFile);
+  }
+
+  double seconds = result.elapsedMicros / 1e6;
+  printf("seed=%lu\n", (unsigned long)seed);
+  printf("ticks=%lu\n", result.ticks);
+  printf("games=%lu\n", result.games);
+  printf("paddle_collisions=%lu\n", result.paddleCollisions);
+  printf("frames=%lu\n", result.frames);
+  printf("frames_pushed=%lu\n", display.getPushCount());
+  printf("frames_skipped=%lu\n", display.getSkippedPushCount());
+  if (frameSink != NULL)
+  {
+    // Compare against a known good run to golden test the rendering
+    printf("frame_hash=%08lx\n", (unsigned long)frameSink->getFrameHash());
+  }
+  if (tilesX > 0 && display.getPushCount() > 0)
+  {
+    // Each tile has its own channel, so a frame takes as long as the busiest one
+    unsigned long busiestWireMicros = 0;
+    for (int i = 0; i < tiledDisplay.getTileCount(); i++)
+    {
+      unsigned long wireMicros = ledChannels[i].getWireMicros();
+      busiestWireMicros = wireMicros > busiestWireMicros ? wireMicros : busiestWireMicros;
+    }
+    printf("led_tiles=%d\n", tiledDisplay.getTileCount());
+    printf("led_refresh_us=%lu\n", busiestWireMicros / display.getPushCount());
+  }
+  if (latency)
+  {
+    printf("handle_p50_cycles=%lu\n", (unsigned long)handleLatency.percentile(500));
+    printf("handle_p99_cycles=%lu\n", (unsigned long)handleLatency.percentile(990));
+    printf("handle_max_cycles=%lu\n", (unsigned long)handleLatency.getMax());
+    printf("render_p50_cycles=%lu\n", (unsigned long)renderLatency.percentile(500));
+    printf("render_p99_cycles=%lu\n", (unsigned long)renderLatency.percentile(990));
+    printf("render_max_cycles=%lu\n", (unsigned long)renderLatency.getMax());
+  }
+  if (recordPath != NULL)
+  {
+    printf("record_bytes=%lu\n", (unsigned long)inputLog.getSize());
+  }
+  if (tracePath != NULL)
+  {
+    printf("trace_events=%lu\n", (unsigned long)traceEvents);
+    printf("trace_lost=%lu\n", (unsigned long)getTraceLostCount());
+  }
+  printf("elapsed_us=%lu\n", result.elapsedMicros);
+  printf("ticks_per_second=%.0f\n", seconds > 0 ? result.ticks / seconds : 0.0);
+  if (ALLOCATION_COUNTING_ENABLED)
+  {
+    printf("tick_allocations=%lu\n", tickAllocations);
+    if (tickAllocations != 0)
+    {
+      fprintf(stderr, "error: the game tick allocated on the heap %lu times\n", tickAllocations);
+      return 1;
+    }
+  }
+  return 0;
+}
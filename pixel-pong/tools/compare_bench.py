@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""
+Compare two PixelPong benchmark runs (CSV output of env:bench_native or
+env:bench_featheresp32) and print the change in ns/op for each benchmark.
+
+Usage: compare_bench.py BASELINE.csv CANDIDATE.csv
+"""
+import csv
+import sys
+
+
+def load(path):
+    """Load a benchmark CSV into a dict of name -> row, skipping comment lines."""
+    with open(path) as f:
+        lines = [line for line in f if line.strip() and not line.startswith("#")]
+    return {row["name"]: row for row in csv.DictReader(lines)}
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    baseline = load(sys.argv[1])
+    candidate = load(sys.argv[2])
+
+    print("{:<40} {:>12} {:>12} {:>9}".format("name", "base ns/op", "new ns/op", "change"))
+    for name in sorted(set(baseline) | set(candidate)):
+        if name not in baseline or name not in candidate:
+            print("{:<40} {:>12} {:>12} {:>9}".format(
+                name,
+                baseline[name]["ns_per_op"] if name in baseline else "-",
+                candidate[name]["ns_per_op"] if name in candidate else "-",
+                "n/a"))
+            continue
+        before = float(baseline[name]["ns_per_op"])
+        after = float(candidate[name]["ns_per_op"])
+        change = ((after - before) / before * 100) if before else 0.0
+        print("{:<40} {:>12.2f} {:>12.2f} {:>+8.1f}%".format(name, before, after, change))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
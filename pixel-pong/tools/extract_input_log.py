@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""
+Extract the input logs the device writes out over Serial at the end of
+each game (between "# inputlog begin" & "# inputlog end" lines) into
+binary files that the simulator can replay with --replay.
+
+Usage: extract_input_log.py CAPTURE.txt [OUTPUT_PREFIX]
+    Writes OUTPUT_PREFIX-000.bin, OUTPUT_PREFIX-001.bin ... (default
+    prefix inputlog) and prints the name of each.
+"""
+import sys
+
+
+def extract(lines):
+    """Yield (header line, bytes) for each complete log in a capture."""
+    header = None
+    data = bytearray()
+    for line in lines:
+        line = line.strip()
+        if line.startswith("# inputlog begin"):
+            header = line
+            data = bytearray()
+        elif line.startswith("# inputlog end"):
+            if header is not None:
+                yield header, bytes(data)
+            header = None
+        elif header is not None:
+            try:
+                data.extend(bytes.fromhex(line))
+            except ValueError:
+                # Something else was printed mid log, it can't be trusted
+                print("skipping a corrupt log: " + header, file=sys.stderr)
+                header = None
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    prefix = sys.argv[2] if len(sys.argv) == 3 else "inputlog"
+    with open(sys.argv[1], errors="replace") as f:
+        logs = list(extract(f))
+
+    for i, (header, data) in enumerate(logs):
+        path = "{}-{:03d}.bin".format(prefix, i)
+        with open(path, "wb") as f:
+            f.write(data)
+        truncated = " (truncated)" if "truncated=1" in header else ""
+        print("{} {} bytes{}".format(path, len(data), truncated))
+    return 0 if logs else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
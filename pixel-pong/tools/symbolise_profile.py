@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Summarise the profiles the device writes out over Serial (between
+"# profile begin" & "# profile end" lines, send 'p' to ask for one):
+how busy each core was, the share of each core taken by each task, and
+the functions the samples fell in, resolved against the firmware ELF.
+The last complete profile in the capture is used.
+
+Usage: symbolise_profile.py CAPTURE.txt FIRMWARE.elf [ADDR2LINE]
+    ADDR2LINE defaults to xtensa-esp32-elf-addr2line (PlatformIO keeps
+    it in ~/.platformio/packages/toolchain-xtensa-esp32/bin), the ELF is
+    .pio/build/featheresp32/firmware.elf.
+"""
+import subprocess
+import sys
+from collections import defaultdict
+
+TOP_FUNCTIONS = 25
+
+
+def extract(lines):
+    """Yield (header line, cores, tasks, samples, runtime) for each complete profile in a capture."""
+    header = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("# profile begin"):
+            header = line
+            cores = {}  # core: (samples, dropped)
+            tasks = {}  # (core, task): (samples, name)
+            samples = []  # (core, pc, task, samples)
+            runtime = []  # (percent, count, name)
+        elif header is None:
+            continue
+        elif line.startswith("# profile end"):
+            yield header, cores, tasks, samples, runtime
+            header = None
+        elif line.startswith("# profile core "):
+            fields = dict(field.split("=") for field in line.split()[4:])
+            cores[int(line.split()[3])] = (int(fields["samples"]), int(fields["dropped"]))
+        elif line.startswith("# profile task "):
+            fields = line.split(" ", 6)
+            tasks[(int(fields[3]), int(fields[4]))] = (int(fields[5]), fields[6] if len(fields) > 6 else "")
+        elif line.startswith("# profile runtime "):
+            fields = line.split(" ", 5)
+            runtime.append((int(fields[3]), int(fields[4]), fields[5] if len(fields) > 5 else ""))
+        elif line.startswith("core,"):
+            continue
+        else:
+            try:
+                core, pc, task, count = line.split(",")
+                samples.append((int(core), int(pc, 16), int(task), int(count)))
+            except ValueError:
+                # Something else was printed mid profile, it can't be trusted
+                print("skipping a corrupt profile: " + header, file=sys.stderr)
+                header = None
+
+
+def symbolise(addr2line, elf, pcs):
+    """Map each PC to (function, file:line) with addr2line, in one batch."""
+    pcs = sorted(pcs)
+    if not pcs:
+        return {}
+    output = subprocess.run([addr2line, "-f", "-C", "-e", elf] + ["{:x}".format(pc) for pc in pcs],
+                            check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout.splitlines()
+    return {pc: (output[2 * i], output[2 * i + 1]) for i, pc in enumerate(pcs)}
+
+
+def percent(part, whole):
+    return 100.0 * part / whole if whole else 0.0
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    addr2line = sys.argv[3] if len(sys.argv) == 4 else "xtensa-esp32-elf-addr2line"
+    with open(sys.argv[1], errors="replace") as f:
+        profiles = list(extract(f))
+    if not profiles:
+        print("no complete profile found", file=sys.stderr)
+        return 1
+    header, cores, tasks, samples, runtime = profiles[-1]
+    symbols = symbolise(addr2line, sys.argv[2], set(pc for _, pc, _, _ in samples))
+
+    print(header.lstrip("# "))
+    for core, (total, dropped) in sorted(cores.items()):
+        # Each core runs its own idle task, any time it isn't running that it's busy
+        idle = sum(count for (task_core, _), (count, name) in tasks.items() if task_core == core and name.startswith("IDLE"))
+        print("\ncore {}: {} samples, {:.1f}% busy, {} dropped (table full)".format(
+            core, total, percent(total - idle, total), dropped))
+        for (task_core, _), (count, name) in sorted(tasks.items(), key=lambda item: -item[1][0]):
+            if task_core == core:
+                print("  {:>6.1f}%  {:>8}  {}".format(percent(count, total), count, name))
+
+    # Per function, per core, the dropped samples can't be placed
+    functions = defaultdict(int)
+    locations = {}
+    for core, pc, _, count in samples:
+        function, location = symbols.get(pc, ("??", "??:0"))
+        functions[(core, function)] += count
+        locations.setdefault((core, function), location)
+    print("\ntop functions (% of the core's samples)")
+    for (core, function), count in sorted(functions.items(), key=lambda item: -item[1])[:TOP_FUNCTIONS]:
+        print("  {:>6.1f}%  {:>8}  core {}  {}  {}".format(
+            percent(count, cores.get(core, (0, 0))[0]), count, core, function, locations[(core, function)]))
+
+    if runtime:
+        print("\nFreeRTOS run time (% of a core)")
+        for task_percent, count, name in sorted(runtime, key=lambda item: -item[1]):
+            print("  {:>5}%  {:>12}  {}".format(task_percent, count, name))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
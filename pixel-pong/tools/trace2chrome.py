@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+Convert the traces the device writes out over Serial (between "# trace
+begin" & "# trace end" lines, send 't' to ask for one) or the simulator
+writes with --trace into Chrome trace JSON, which opens in Perfetto
+(ui.perfetto.dev) or chrome://tracing.
+Each core is a process, with a thread per task plus one for interrupts.
+
+Usage: trace2chrome.py CAPTURE.txt [OUTPUT_PREFIX]
+    Writes OUTPUT_PREFIX-000.json, OUTPUT_PREFIX-001.json ... (default
+    prefix trace) and prints the name of each.
+"""
+import json
+import struct
+import sys
+
+# Matches Trace.h
+EVENT = struct.Struct("<IBBBB")
+TRACK_OTHER = 0xFE
+TRACK_INTERRUPT = 0xFF
+
+
+def extract(lines):
+    """Yield (header line, point names, track names, bytes) for each complete trace in a capture."""
+    header = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("# trace begin"):
+            header = line
+            points = {}
+            tracks = {TRACK_OTHER: "other tasks", TRACK_INTERRUPT: "interrupts"}
+            data = bytearray()
+        elif header is None:
+            continue
+        elif line.startswith("# trace end"):
+            yield header, points, tracks, bytes(data)
+            header = None
+        elif line.startswith("# trace point ") or line.startswith("# trace track "):
+            fields = line.split(" ", 4)
+            names = points if fields[2] == "point" else tracks
+            names[int(fields[3])] = fields[4] if len(fields) > 4 else fields[3]
+        else:
+            try:
+                data.extend(bytes.fromhex(line))
+            except ValueError:
+                # Something else was printed mid trace, it can't be trusted
+                print("skipping a corrupt trace: " + header, file=sys.stderr)
+                header = None
+
+
+def convert(points, tracks, data):
+    """Turn a trace's events into a list of Chrome trace events."""
+    events = []
+    seen = set()
+    # Spans still open on each (core, track), an end without a begin
+    # (the begin was overwritten, or the trace started mid span) is dropped
+    open_spans = {}
+    last_raw = None
+    now = 0
+    for offset in range(0, len(data) - EVENT.size + 1, EVENT.size):
+        raw, point, phase, track, core = EVENT.unpack_from(data, offset)
+        # Microseconds since the first event, the 32 bit clock wraps every ~71 minutes
+        if last_raw is not None:
+            delta = (raw - last_raw) & 0xFFFFFFFF
+            now += delta - (1 << 32) if delta >= 1 << 31 else delta
+        last_raw = raw
+        seen.add((core, track))
+        name = points.get(point, "point{}".format(point))
+        stack = open_spans.setdefault((core, track), [])
+        event = {"name": name, "ph": chr(phase), "ts": now, "pid": core, "tid": track}
+        if phase == ord("B"):
+            stack.append(point)
+        elif phase == ord("E"):
+            if not stack or stack[-1] != point:
+                continue
+            stack.pop()
+        elif phase == ord("i"):
+            event["s"] = "t"
+        else:
+            continue
+        events.append(event)
+
+    for core in sorted(set(core for core, _ in seen)):
+        events.append({"name": "process_name", "ph": "M", "pid": core, "args": {"name": "core {}".format(core)}})
+    for core, track in sorted(seen):
+        events.append({"name": "thread_name", "ph": "M", "pid": core, "tid": track,
+                       "args": {"name": tracks.get(track, "track{}".format(track))}})
+    return events
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    prefix = sys.argv[2] if len(sys.argv) == 3 else "trace"
+    with open(sys.argv[1], errors="replace") as f:
+        traces = list(extract(f))
+
+    for i, (header, points, tracks, data) in enumerate(traces):
+        path = "{}-{:03d}.json".format(prefix, i)
+        events = convert(points, tracks, data)
+        with open(path, "w") as f:
+            json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+        lost = header.split("lost=")[-1] if "lost=" in header else "0"
+        print("{} {} events ({} lost before)".format(path, len(data) // EVENT.size, lost))
+    return 0 if traces else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())